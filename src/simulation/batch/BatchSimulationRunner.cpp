@@ -6,6 +6,7 @@
 #include <cmath>
 #include <algorithm>
 #include <numeric>
+#include <thread>
 
 namespace batch
 {
@@ -19,6 +20,7 @@ BatchSimulationRunner::BatchSimulationRunner()
 BatchSimulationRunner::~BatchSimulationRunner()
 {
     cancel();
+    releaseDispatchers();
 }
 
 void BatchSimulationRunner::configure(const BatchConfig& config)
@@ -84,23 +86,92 @@ std::vector<SimulationResult> BatchSimulationRunner::run(
 {
     m_running.store(true);
     m_cancelled.store(false);
+    m_completedReplicates = 0;
 
     std::vector<SimulationResult> results;
-    results.reserve(m_config.numReplicates);
 
-    for (int i = 0; i < m_config.numReplicates && !m_cancelled.load(); ++i)
+    m_threadSplit = resolveThreadSplit();
+    const int workerCount = m_threadSplit.workers;
+
+    if (!createDispatchers(workerCount, m_threadSplit.sceneThreads))
     {
-        uint32_t seed = m_config.baseSeed + static_cast<uint32_t>(i);
-        auto result = runSingleReplicate(physics, sceneFactory, i, seed);
-        results.push_back(std::move(result));
+        releaseDispatchers();
 
-        // Progress callback
-        if (m_config.progressCallback)
+        // Every replicate fails, as runSingleReplicate() reports it
+        results.resize(std::max(0, m_config.numReplicates));
+        for (int i = 0; i < static_cast<int>(results.size()); ++i)
         {
-            m_config.progressCallback(i + 1, m_config.numReplicates);
+            results[i].replicateId = i;
+            results[i].seed = m_config.baseSeed + static_cast<uint32_t>(i);
+            results[i].success = false;
+            results[i].errorMessage = "Failed to create CPU dispatcher";
         }
+
+        m_running.store(false);
+        return results;
     }
 
+    if (workerCount <= 1)
+    {
+        results.reserve(m_config.numReplicates);
+
+        ReplicateInstruments instruments = makeInstruments(false);
+
+        for (int i = 0; i < m_config.numReplicates && !m_cancelled.load(); ++i)
+        {
+            uint32_t seed = m_config.baseSeed + static_cast<uint32_t>(i);
+            results.push_back(runReplicate(physics, sceneFactory, i, seed, m_dispatchers[0], instruments));
+            reportProgress();
+        }
+    }
+    else
+    {
+        // Results are written by replicate ID so ordering does not depend on scheduling
+        std::vector<SimulationResult> slots(m_config.numReplicates);
+        std::vector<char> finished(m_config.numReplicates, 0);
+        std::atomic<int> nextReplicate{0};
+
+        auto worker = [&](int workerIndex)
+        {
+            ReplicateInstruments instruments = makeInstruments(true);
+            physx::PxCpuDispatcher* dispatcher = m_dispatchers[workerIndex];
+
+            while (!m_cancelled.load())
+            {
+                int i = nextReplicate.fetch_add(1);
+                if (i >= m_config.numReplicates)
+                    break;
+
+                uint32_t seed = m_config.baseSeed + static_cast<uint32_t>(i);
+                slots[i] = runReplicate(physics, sceneFactory, i, seed, dispatcher, instruments);
+                finished[i] = 1;
+                reportProgress();
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(workerCount);
+        for (int w = 0; w < workerCount; ++w)
+        {
+            threads.emplace_back(worker, w);
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Drop replicates that never ran (cancelled batch)
+        results.reserve(m_config.numReplicates);
+        for (int i = 0; i < m_config.numReplicates; ++i)
+        {
+            if (finished[i])
+            {
+                results.push_back(std::move(slots[i]));
+            }
+        }
+    }
+
+    releaseDispatchers();
     m_running.store(false);
     return results;
 }
@@ -110,6 +181,143 @@ SimulationResult BatchSimulationRunner::runSingleReplicate(
     SceneFactory sceneFactory,
     int replicateId,
     uint32_t seed)
+{
+    physx::PxDefaultCpuDispatcher* dispatcher =
+        physx::PxDefaultCpuDispatcherCreate(static_cast<physx::PxU32>(std::max(0, m_config.sceneThreads)));
+    if (!dispatcher)
+    {
+        SimulationResult result;
+        result.replicateId = replicateId;
+        result.seed = seed;
+        result.success = false;
+        result.errorMessage = "Failed to create CPU dispatcher";
+        return result;
+    }
+
+    ReplicateInstruments instruments = makeInstruments(false);
+    SimulationResult result = runReplicate(physics, sceneFactory, replicateId, seed, dispatcher, instruments);
+
+    dispatcher->release();
+    return result;
+}
+
+ThreadSplit BatchSimulationRunner::computeThreadSplit(
+    int threadBudget, int numReplicates, size_t actorsPerScene)
+{
+    ThreadSplit split;
+    threadBudget = std::max(1, threadBudget);
+    numReplicates = std::max(1, numReplicates);
+
+    // Dispatcher threads a single scene can keep busy
+    int desiredSceneThreads = 0;
+    if (actorsPerScene >= 32768)
+        desiredSceneThreads = 8;
+    else if (actorsPerScene >= 8192)
+        desiredSceneThreads = 4;
+    else if (actorsPerScene >= 2048)
+        desiredSceneThreads = 2;
+
+    split.sceneThreads = std::min(desiredSceneThreads, threadBudget);
+    split.workers = std::min(numReplicates, threadBudget / std::max(1, split.sceneThreads));
+    split.workers = std::max(1, split.workers);
+
+    // Too few replicates to fill the budget: hand the rest to the scenes
+    if (desiredSceneThreads > 0 && split.workers == numReplicates)
+    {
+        split.sceneThreads = std::max(split.sceneThreads, threadBudget / split.workers);
+    }
+
+    return split;
+}
+
+ThreadSplit BatchSimulationRunner::resolveThreadSplit() const
+{
+    int budget = m_config.threadBudget;
+    if (budget <= 0)
+    {
+        budget = static_cast<int>(std::thread::hardware_concurrency());
+        if (budget <= 0)
+            budget = 1;
+    }
+
+    if (m_config.autoTuneThreads)
+    {
+        return computeThreadSplit(budget, m_config.numReplicates, m_config.expectedActorsPerScene);
+    }
+
+    ThreadSplit split;
+    split.sceneThreads = std::max(0, m_config.sceneThreads);
+
+    // Each worker occupies its own thread while PhysX tasks run inline,
+    // or blocks in fetchResults while the dispatcher threads run them
+    const int threadsPerWorker = std::max(1, split.sceneThreads);
+    const int maxWorkers = std::max(1, budget / threadsPerWorker);
+
+    int workers = m_config.numWorkers;
+    if (workers <= 0)
+        workers = maxWorkers;
+
+    split.workers = std::max(1, std::min({workers, maxWorkers, m_config.numReplicates}));
+    return split;
+}
+
+bool BatchSimulationRunner::createDispatchers(int count, int threadsPerDispatcher)
+{
+    releaseDispatchers();
+    m_dispatchers.reserve(count);
+
+    for (int i = 0; i < count; ++i)
+    {
+        physx::PxDefaultCpuDispatcher* dispatcher =
+            physx::PxDefaultCpuDispatcherCreate(static_cast<physx::PxU32>(threadsPerDispatcher));
+        if (!dispatcher)
+            return false;
+
+        m_dispatchers.push_back(dispatcher);
+    }
+
+    return true;
+}
+
+void BatchSimulationRunner::releaseDispatchers()
+{
+    for (auto* dispatcher : m_dispatchers)
+    {
+        dispatcher->release();
+    }
+    m_dispatchers.clear();
+}
+
+BatchSimulationRunner::ReplicateInstruments BatchSimulationRunner::makeInstruments(bool cloned) const
+{
+    ReplicateInstruments instruments;
+    instruments.metrics.reserve(m_metrics.size());
+    instruments.conditions.reserve(m_conditions.size());
+
+    for (const auto& metric : m_metrics)
+    {
+        MetricPtr instance = cloned ? MetricPtr(metric->clone()) : metric;
+        instruments.metricMap[metric.get()] = instance;
+        instruments.metricMap[instance.get()] = instance;
+        instruments.metrics.push_back(std::move(instance));
+    }
+
+    for (const auto& cond : m_conditions)
+    {
+        instruments.conditions.push_back(
+            cloned ? TerminationConditionPtr(cond->clone()) : cond);
+    }
+
+    return instruments;
+}
+
+SimulationResult BatchSimulationRunner::runReplicate(
+    physx::PxPhysics* physics,
+    const SceneFactory& sceneFactory,
+    int replicateId,
+    uint32_t seed,
+    physx::PxCpuDispatcher* dispatcher,
+    ReplicateInstruments& instruments)
 {
     SimulationResult result;
     result.replicateId = replicateId;
@@ -118,7 +326,7 @@ SimulationResult BatchSimulationRunner::runSingleReplicate(
     try
     {
         // Create scene
-        physx::PxScene* scene = createScene(physics);
+        physx::PxScene* scene = createScene(physics, dispatcher);
         if (!scene)
         {
             result.success = false;
@@ -130,13 +338,19 @@ SimulationResult BatchSimulationRunner::runSingleReplicate(
         auto bondManager = std::make_unique<bonding::DynamicBondManager>();
         bondManager->initialize(physics, scene);
 
-        // Reset metrics and conditions
-        for (auto& metric : m_metrics)
+        // Bind and reset metrics and conditions
+        ReplicateContext context;
+        context.bondManager = bondManager.get();
+        context.metrics = instruments.metricMap;
+
+        for (auto& metric : instruments.metrics)
         {
+            metric->bindToReplicate(context);
             metric->reset();
         }
-        for (auto& cond : m_conditions)
+        for (auto& cond : instruments.conditions)
         {
+            cond->bindToReplicate(context);
             cond->reset();
         }
 
@@ -144,10 +358,10 @@ SimulationResult BatchSimulationRunner::runSingleReplicate(
         sceneFactory(physics, scene, bondManager.get(), seed);
 
         // Run simulation
-        runSimulationLoop(scene, bondManager.get(), result);
+        runSimulationLoop(scene, bondManager.get(), instruments, result);
 
         // Collect final metrics
-        collectFinalMetrics(result);
+        collectFinalMetrics(instruments, result);
 
         // Cleanup
         bondManager->releaseAll();
@@ -164,21 +378,32 @@ SimulationResult BatchSimulationRunner::runSingleReplicate(
     return result;
 }
 
+void BatchSimulationRunner::reportProgress()
+{
+    std::lock_guard<std::mutex> lock(m_progressMutex);
+    m_completedReplicates++;
+
+    if (m_config.progressCallback)
+    {
+        m_config.progressCallback(m_completedReplicates, m_config.numReplicates);
+    }
+}
+
 void BatchSimulationRunner::cancel()
 {
     m_cancelled.store(true);
 }
 
-physx::PxScene* BatchSimulationRunner::createScene(physx::PxPhysics* physics)
+physx::PxScene* BatchSimulationRunner::createScene(
+    physx::PxPhysics* physics, physx::PxCpuDispatcher* dispatcher)
 {
-    physx::PxSceneDesc sceneDesc(physics->getTolerancesScale());
-    sceneDesc.gravity = physx::PxVec3(0.0f, -9.81f, 0.0f);
-
-    // Create CPU dispatcher
-    physx::PxDefaultCpuDispatcher* dispatcher = physx::PxDefaultCpuDispatcherCreate(2);
     if (!dispatcher)
         return nullptr;
 
+    physx::PxSceneDesc sceneDesc(physics->getTolerancesScale());
+    sceneDesc.gravity = physx::PxVec3(0.0f, -9.81f, 0.0f);
+
+    // Dispatcher is owned by the runner and outlives the scene
     sceneDesc.cpuDispatcher = dispatcher;
     sceneDesc.filterShader = physx::PxDefaultSimulationFilterShader;
 
@@ -188,6 +413,7 @@ physx::PxScene* BatchSimulationRunner::createScene(physx::PxPhysics* physics)
 void BatchSimulationRunner::runSimulationLoop(
     physx::PxScene* scene,
     bonding::DynamicBondManager* bondManager,
+    ReplicateInstruments& instruments,
     SimulationResult& result)
 {
     float time = 0.0f;
@@ -210,12 +436,12 @@ void BatchSimulationRunner::runSimulationLoop(
         if (m_config.metricUpdateInterval <= 0.0f ||
             metricUpdateAccum >= m_config.metricUpdateInterval)
         {
-            updateMetrics(scene, time, metricUpdateAccum);
+            updateMetrics(instruments, scene, time, metricUpdateAccum);
             metricUpdateAccum = 0.0f;
         }
 
         // Check termination
-        std::string terminationReason = checkTermination(scene, time);
+        std::string terminationReason = checkTermination(instruments, scene, time);
         if (!terminationReason.empty())
         {
             result.terminationReason = terminationReason;
@@ -233,12 +459,13 @@ void BatchSimulationRunner::runSimulationLoop(
     }
 
     // Final metric update
-    updateMetrics(scene, time, 0.0f);
+    updateMetrics(instruments, scene, time, 0.0f);
 }
 
-std::string BatchSimulationRunner::checkTermination(physx::PxScene* scene, float time)
+std::string BatchSimulationRunner::checkTermination(
+    const ReplicateInstruments& instruments, physx::PxScene* scene, float time)
 {
-    for (const auto& cond : m_conditions)
+    for (const auto& cond : instruments.conditions)
     {
         if (cond->shouldTerminate(scene, time))
         {
@@ -248,17 +475,19 @@ std::string BatchSimulationRunner::checkTermination(physx::PxScene* scene, float
     return "";
 }
 
-void BatchSimulationRunner::updateMetrics(physx::PxScene* scene, float time, float dt)
+void BatchSimulationRunner::updateMetrics(
+    ReplicateInstruments& instruments, physx::PxScene* scene, float time, float dt)
 {
-    for (auto& metric : m_metrics)
+    for (auto& metric : instruments.metrics)
     {
         metric->update(scene, time, dt);
     }
 }
 
-void BatchSimulationRunner::collectFinalMetrics(SimulationResult& result)
+void BatchSimulationRunner::collectFinalMetrics(
+    const ReplicateInstruments& instruments, SimulationResult& result)
 {
-    for (const auto& metric : m_metrics)
+    for (const auto& metric : instruments.metrics)
     {
         result.finalMetrics[metric->getName()] = metric->getValue();
 
@@ -10,6 +10,7 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 
 namespace batch
 {
@@ -38,7 +39,28 @@ struct BatchConfig
     /// Whether to run simulations in headless mode (no rendering)
     bool headless = true;
 
+    /// Number of replicates simulated concurrently (1 = sequential, 0 = fill the thread budget)
+    /// Each worker runs its own scene with cloned metrics and termination conditions,
+    /// so the scene factory and any CustomMetric/CustomCondition callables must be thread-safe.
+    int numWorkers = 1;
+
+    /// Total CPU threads the batch may occupy (0 = hardware concurrency)
+    /// Each worker costs max(sceneThreads, 1) threads; numWorkers is clamped to fit.
+    int threadBudget = 0;
+
+    /// PhysX dispatcher worker threads per scene (0 = run PhysX tasks on the worker thread)
+    int sceneThreads = 2;
+
+    /// Pick numWorkers and sceneThreads from threadBudget and expectedActorsPerScene
+    /// Overrides the explicit numWorkers/sceneThreads values when enabled.
+    bool autoTuneThreads = false;
+
+    /// Approximate number of actors per replicate scene, used by auto-tuning
+    /// (0 = unknown, treated as a small scene)
+    size_t expectedActorsPerScene = 0;
+
     /// Optional progress callback (called after each replicate)
+    /// Calls are serialized, but may come from worker threads when numWorkers != 1
     std::function<void(int completedReplicates, int totalReplicates)> progressCallback;
 };
 
@@ -81,6 +103,16 @@ using SceneFactory = std::function<void(
     bonding::DynamicBondManager* bondManager,
     uint32_t seed)>;
 
+/// Split of the thread budget between replicates and PhysX tasks
+struct ThreadSplit
+{
+    /// Replicates simulated concurrently
+    int workers = 1;
+
+    /// Dispatcher threads per replicate scene
+    int sceneThreads = 0;
+};
+
 /// Runs batch simulations and collects statistics
 class BatchSimulationRunner
 {
@@ -115,7 +147,7 @@ public:
     /// Run all simulations
     /// @param physics PhysX physics object to use
     /// @param sceneFactory Factory function to create scenes
-    /// @return Results from all replicates
+    /// @return Results from all replicates, ordered by replicate ID
     std::vector<SimulationResult> run(
         physx::PxPhysics* physics,
         SceneFactory sceneFactory);
@@ -164,30 +196,88 @@ public:
 
     static SummaryStats calculateSummary(const std::vector<SimulationResult>& results);
 
+    /// Choose a thread split for a batch
+    /// Small scenes gain little from intra-scene parallelism, so they run PhysX tasks
+    /// inline and spend the budget on replicates; larger scenes get more dispatcher threads.
+    /// @param threadBudget Total threads available (must be >= 1)
+    /// @param numReplicates Number of replicates in the batch
+    /// @param actorsPerScene Approximate scene size (0 = unknown)
+    static ThreadSplit computeThreadSplit(int threadBudget, int numReplicates, size_t actorsPerScene);
+
+    /// Thread split used by the most recent run()
+    const ThreadSplit& getThreadSplit() const { return m_threadSplit; }
+
 private:
+    /// Metrics and conditions used by one replicate at a time
+    /// Sequential runs use the runner's own instances; each parallel worker owns clones.
+    struct ReplicateInstruments
+    {
+        std::vector<MetricPtr> metrics;
+        std::vector<TerminationConditionPtr> conditions;
+
+        /// Runner-level metric -> instance in this set (see ReplicateContext::metrics)
+        std::unordered_map<const IMetric*, MetricPtr> metricMap;
+    };
+
     BatchConfig m_config;
     std::vector<MetricPtr> m_metrics;
     std::vector<TerminationConditionPtr> m_conditions;
     std::atomic<bool> m_running{false};
     std::atomic<bool> m_cancelled{false};
 
+    /// Serializes progressCallback across workers
+    std::mutex m_progressMutex;
+    int m_completedReplicates = 0;
+
+    /// One CPU dispatcher per worker, owned by the runner for the duration of run()
+    std::vector<physx::PxDefaultCpuDispatcher*> m_dispatchers;
+    ThreadSplit m_threadSplit;
+
+    /// Resolve the thread budget and worker/scene thread counts from the config
+    ThreadSplit resolveThreadSplit() const;
+
+    /// Create the dispatcher pool for a run
+    bool createDispatchers(int count, int threadsPerDispatcher);
+
+    /// Release the dispatcher pool
+    void releaseDispatchers();
+
+    /// Build the instrument set for the calling thread
+    /// @param cloned true to clone metrics/conditions (parallel workers)
+    ReplicateInstruments makeInstruments(bool cloned) const;
+
+    /// Run one replicate with the given instruments
+    SimulationResult runReplicate(
+        physx::PxPhysics* physics,
+        const SceneFactory& sceneFactory,
+        int replicateId,
+        uint32_t seed,
+        physx::PxCpuDispatcher* dispatcher,
+        ReplicateInstruments& instruments);
+
+    /// Report a finished replicate through progressCallback
+    void reportProgress();
+
     /// Create a fresh PhysX scene for a replicate
-    physx::PxScene* createScene(physx::PxPhysics* physics);
+    physx::PxScene* createScene(physx::PxPhysics* physics, physx::PxCpuDispatcher* dispatcher);
 
     /// Run the simulation loop for one replicate
     void runSimulationLoop(
         physx::PxScene* scene,
         bonding::DynamicBondManager* bondManager,
+        ReplicateInstruments& instruments,
         SimulationResult& result);
 
     /// Check all termination conditions
-    std::string checkTermination(physx::PxScene* scene, float time);
+    std::string checkTermination(
+        const ReplicateInstruments& instruments, physx::PxScene* scene, float time);
 
     /// Update all metrics
-    void updateMetrics(physx::PxScene* scene, float time, float dt);
+    void updateMetrics(
+        ReplicateInstruments& instruments, physx::PxScene* scene, float time, float dt);
 
     /// Collect final metric values
-    void collectFinalMetrics(SimulationResult& result);
+    void collectFinalMetrics(const ReplicateInstruments& instruments, SimulationResult& result);
 };
 
 } // namespace batch
@@ -1,7 +1,5 @@
 #include "CommonMetrics.h"
 #include <algorithm>
-#include <queue>
-#include <unordered_map>
 
 namespace batch
 {
@@ -67,6 +65,7 @@ RingFormationMetric::RingFormationMetric(bonding::DynamicBondManager* bondManage
     : m_bondManager(bondManager)
     , m_targetRingSize(targetRingSize)
 {
+    requireTargetRingSize();
 }
 
 std::string RingFormationMetric::getDescription() const
@@ -81,15 +80,17 @@ void RingFormationMetric::update(physx::PxScene* scene, float time, float dt)
     (void)scene;
     (void)dt;
 
-    if (m_ringFormed)
+    if (m_ringFormed || !m_bondManager)
         return; // Already found a ring
 
-    int ringSize = 0;
-    if (detectRing(ringSize))
+    // The bond manager tracks the rings in the current bond graph
+    const bonding::RingEvent* ring = m_bondManager->getRingDetector().findFirstRing(
+        static_cast<uint32_t>(std::max(m_targetRingSize, 0)));
+    if (ring)
     {
         m_ringFormed = true;
         m_ringFormationTime = time;
-        m_detectedRingSize = ringSize;
+        m_detectedRingSize = static_cast<int>(ring->ringSize);
     }
 }
 
@@ -112,64 +113,18 @@ std::unique_ptr<IMetric> RingFormationMetric::clone() const
     return std::make_unique<RingFormationMetric>(m_bondManager, m_targetRingSize);
 }
 
-bool RingFormationMetric::detectRing(int& ringSize) const
+void RingFormationMetric::bindToReplicate(const ReplicateContext& context)
 {
-    if (!m_bondManager)
-        return false;
-
-    const auto& bonds = m_bondManager->getBonds();
-
-    // Build adjacency list
-    std::unordered_map<uint64_t, std::vector<uint64_t>> adjacency;
-    for (const auto& [bondId, bond] : bonds)
-    {
-        adjacency[bond.endpoint1.entityId].push_back(bond.endpoint2.entityId);
-        adjacency[bond.endpoint2.entityId].push_back(bond.endpoint1.entityId);
-    }
-
-    // DFS to find cycles
-    std::unordered_set<uint64_t> visited;
-    std::unordered_map<uint64_t, int> depth;
+    m_bondManager = context.bondManager;
+    requireTargetRingSize();
+}
 
-    std::function<bool(uint64_t, uint64_t, int)> dfs = [&](uint64_t node, uint64_t parent, int d) -> bool
-    {
-        if (visited.count(node))
-        {
-            // Found a cycle
-            int cycleSize = d - depth[node];
-            if (m_targetRingSize == 0 || cycleSize == m_targetRingSize)
-            {
-                ringSize = cycleSize;
-                return true;
-            }
-            return false;
-        }
-
-        visited.insert(node);
-        depth[node] = d;
-
-        for (uint64_t neighbor : adjacency[node])
-        {
-            if (neighbor != parent)
-            {
-                if (dfs(neighbor, node, d + 1))
-                    return true;
-            }
-        }
-
-        return false;
-    };
-
-    for (const auto& [entityId, neighbors] : adjacency)
+void RingFormationMetric::requireTargetRingSize()
+{
+    if (m_bondManager && m_targetRingSize > 0)
     {
-        if (!visited.count(entityId))
-        {
-            if (dfs(entityId, 0, 0))
-                return true;
-        }
+        m_bondManager->requireRingSize(static_cast<uint32_t>(m_targetRingSize));
     }
-
-    return false;
 }
 
 // =============================================================================
@@ -268,18 +223,33 @@ void ClusterSizeMetric::update(physx::PxScene* scene, float time, float dt)
     (void)time;
     (void)dt;
 
-    findClusters();
+    if (!m_bondManager)
+        return;
+
+    // The tracker keeps clusters current as bonds form and break
+    const bonding::ClusterTracker& clusters = m_bondManager->getClusterTracker();
+    m_sizeHistogram = clusters.getSizeHistogram();
+    m_largestClusterSize = static_cast<int>(clusters.getLargestClusterSize());
+    m_clusterCount = static_cast<int>(clusters.getClusterCount());
 }
 
 MetricValue ClusterSizeMetric::getValue() const
 {
-    return std::vector<int>(m_clusterSizes);
+    // Cluster sizes, largest first
+    std::vector<int> clusterSizes;
+    clusterSizes.reserve(m_clusterCount);
+    for (auto it = m_sizeHistogram.rbegin(); it != m_sizeHistogram.rend(); ++it)
+    {
+        clusterSizes.insert(clusterSizes.end(), it->second, static_cast<int>(it->first));
+    }
+    return clusterSizes;
 }
 
 void ClusterSizeMetric::reset()
 {
-    m_clusterSizes.clear();
+    m_sizeHistogram.clear();
     m_largestClusterSize = 0;
+    m_clusterCount = 0;
 }
 
 std::unique_ptr<IMetric> ClusterSizeMetric::clone() const
@@ -287,67 +257,6 @@ std::unique_ptr<IMetric> ClusterSizeMetric::clone() const
     return std::make_unique<ClusterSizeMetric>(m_bondManager);
 }
 
-void ClusterSizeMetric::findClusters()
-{
-    m_clusterSizes.clear();
-    m_largestClusterSize = 0;
-
-    if (!m_bondManager)
-        return;
-
-    // Build adjacency list
-    std::unordered_map<uint64_t, std::vector<uint64_t>> adjacency;
-    auto entityIds = m_bondManager->getEntityIds();
-
-    for (uint64_t id : entityIds)
-    {
-        adjacency[id] = {}; // Initialize even for isolated entities
-    }
-
-    const auto& bonds = m_bondManager->getBonds();
-    for (const auto& [bondId, bond] : bonds)
-    {
-        adjacency[bond.endpoint1.entityId].push_back(bond.endpoint2.entityId);
-        adjacency[bond.endpoint2.entityId].push_back(bond.endpoint1.entityId);
-    }
-
-    // BFS to find connected components
-    std::unordered_set<uint64_t> visited;
-
-    for (uint64_t startId : entityIds)
-    {
-        if (visited.count(startId))
-            continue;
-
-        int clusterSize = 0;
-        std::queue<uint64_t> queue;
-        queue.push(startId);
-        visited.insert(startId);
-
-        while (!queue.empty())
-        {
-            uint64_t current = queue.front();
-            queue.pop();
-            clusterSize++;
-
-            for (uint64_t neighbor : adjacency[current])
-            {
-                if (!visited.count(neighbor))
-                {
-                    visited.insert(neighbor);
-                    queue.push(neighbor);
-                }
-            }
-        }
-
-        m_clusterSizes.push_back(clusterSize);
-        m_largestClusterSize = std::max(m_largestClusterSize, clusterSize);
-    }
-
-    // Sort cluster sizes descending
-    std::sort(m_clusterSizes.begin(), m_clusterSizes.end(), std::greater<int>());
-}
-
 // =============================================================================
 // DistanceMetric
 // =============================================================================
@@ -24,6 +24,7 @@ public:
     std::vector<std::pair<float, MetricValue>> getTimeSeries() const override;
     void reset() override;
     std::unique_ptr<IMetric> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override { m_bondManager = context.bondManager; }
 
 private:
     bonding::DynamicBondManager* m_bondManager;
@@ -37,7 +38,8 @@ class RingFormationMetric : public IMetric
 {
 public:
     /// @param bondManager Reference to the bond manager
-    /// @param targetRingSize Size of ring to detect (0 = any size)
+    /// @param targetRingSize Size of ring to detect (0 = any size); the bond
+    ///        manager measures rings of at least this size exactly
     explicit RingFormationMetric(bonding::DynamicBondManager* bondManager, int targetRingSize = 0);
 
     std::string getName() const override { return "ring_formation"; }
@@ -47,6 +49,7 @@ public:
     MetricValue getValue() const override;
     void reset() override;
     std::unique_ptr<IMetric> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override;
 
     /// Check if a ring has formed
     bool hasRingFormed() const { return m_ringFormed; }
@@ -64,8 +67,8 @@ private:
     float m_ringFormationTime = -1.0f;
     int m_detectedRingSize = 0;
 
-    /// Detect ring using DFS
-    bool detectRing(int& ringSize) const;
+    /// Raise the manager's ring size limit to the target size
+    void requireTargetRingSize();
 };
 
 /// Metric: Tracks total kinetic energy
@@ -104,20 +107,22 @@ public:
     MetricValue getValue() const override;
     void reset() override;
     std::unique_ptr<IMetric> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override { m_bondManager = context.bondManager; }
 
     /// Get the largest cluster size
     int getLargestClusterSize() const { return m_largestClusterSize; }
 
     /// Get the number of clusters
-    int getClusterCount() const { return static_cast<int>(m_clusterSizes.size()); }
+    int getClusterCount() const { return m_clusterCount; }
+
+    /// Get the number of clusters of each size
+    const bonding::ClusterTracker::SizeHistogram& getSizeHistogram() const { return m_sizeHistogram; }
 
 private:
     bonding::DynamicBondManager* m_bondManager;
-    std::vector<int> m_clusterSizes;
+    bonding::ClusterTracker::SizeHistogram m_sizeHistogram;
     int m_largestClusterSize = 0;
-
-    /// Find connected components
-    void findClusters();
+    int m_clusterCount = 0;
 };
 
 /// Metric: Tracks distance between specific entities
@@ -141,6 +146,7 @@ public:
     std::vector<std::pair<float, MetricValue>> getTimeSeries() const override;
     void reset() override;
     std::unique_ptr<IMetric> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override { m_bondManager = context.bondManager; }
 
 private:
     uint64_t m_entity1Id;
@@ -193,6 +199,7 @@ public:
     MetricValue getValue() const override;
     void reset() override;
     std::unique_ptr<IMetric> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override { m_bondManager = context.bondManager; }
 
 private:
     bonding::DynamicBondManager* m_bondManager;
@@ -212,6 +219,7 @@ public:
     MetricValue getValue() const override;
     void reset() override;
     std::unique_ptr<IMetric> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override { m_bondManager = context.bondManager; }
 
 private:
     bonding::DynamicBondManager* m_bondManager;
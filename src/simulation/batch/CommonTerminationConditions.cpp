@@ -1,6 +1,5 @@
 #include "CommonTerminationConditions.h"
-#include <unordered_set>
-#include <unordered_map>
+#include <algorithm>
 #include <queue>
 #include <cmath>
 #include <numeric>
@@ -163,13 +162,14 @@ RingFormationCondition::RingFormationCondition(
     : m_bondManager(bondManager)
     , m_targetRingSize(targetRingSize)
 {
+    requireTargetRingSize();
 }
 
 std::string RingFormationCondition::getDescription() const
 {
     if (m_targetRingSize > 0)
-        return "Terminates when ring of size " + std::to_string(m_targetRingSize) + " forms";
-    return "Terminates when any ring forms";
+        return "Terminates while a ring of size " + std::to_string(m_targetRingSize) + " exists";
+    return "Terminates while any ring exists";
 }
 
 bool RingFormationCondition::shouldTerminate(physx::PxScene* scene, float time) const
@@ -177,8 +177,12 @@ bool RingFormationCondition::shouldTerminate(physx::PxScene* scene, float time)
     (void)scene;
     (void)time;
 
-    int ringSize = 0;
-    return detectRing(ringSize);
+    if (!m_bondManager)
+        return false;
+
+    // The bond manager tracks the rings in the current bond graph
+    return m_bondManager->getRingDetector().findFirstRing(
+        static_cast<uint32_t>(std::max(m_targetRingSize, 0))) != nullptr;
 }
 
 void RingFormationCondition::reset()
@@ -191,63 +195,18 @@ std::unique_ptr<ITerminationCondition> RingFormationCondition::clone() const
     return std::make_unique<RingFormationCondition>(m_bondManager, m_targetRingSize);
 }
 
-bool RingFormationCondition::detectRing(int& ringSize) const
+void RingFormationCondition::bindToReplicate(const ReplicateContext& context)
 {
-    if (!m_bondManager)
-        return false;
-
-    const auto& bonds = m_bondManager->getBonds();
-
-    // Build adjacency list
-    std::unordered_map<uint64_t, std::vector<uint64_t>> adjacency;
-    for (const auto& [bondId, bond] : bonds)
-    {
-        adjacency[bond.endpoint1.entityId].push_back(bond.endpoint2.entityId);
-        adjacency[bond.endpoint2.entityId].push_back(bond.endpoint1.entityId);
-    }
-
-    // DFS to find cycles
-    std::unordered_set<uint64_t> visited;
-    std::unordered_map<uint64_t, int> depth;
-
-    std::function<bool(uint64_t, uint64_t, int)> dfs = [&](uint64_t node, uint64_t parent, int d) -> bool
-    {
-        if (visited.count(node))
-        {
-            int cycleSize = d - depth[node];
-            if (m_targetRingSize == 0 || cycleSize == m_targetRingSize)
-            {
-                ringSize = cycleSize;
-                return true;
-            }
-            return false;
-        }
-
-        visited.insert(node);
-        depth[node] = d;
-
-        for (uint64_t neighbor : adjacency[node])
-        {
-            if (neighbor != parent)
-            {
-                if (dfs(neighbor, node, d + 1))
-                    return true;
-            }
-        }
-
-        return false;
-    };
+    m_bondManager = context.bondManager;
+    requireTargetRingSize();
+}
 
-    for (const auto& [entityId, neighbors] : adjacency)
+void RingFormationCondition::requireTargetRingSize()
+{
+    if (m_bondManager && m_targetRingSize > 0)
     {
-        if (!visited.count(entityId))
-        {
-            if (dfs(entityId, 0, 0))
-                return true;
-        }
+        m_bondManager->requireRingSize(static_cast<uint32_t>(m_targetRingSize));
     }
-
-    return false;
 }
 
 // =============================================================================
@@ -391,6 +350,16 @@ std::unique_ptr<ITerminationCondition> MetricThresholdCondition::clone() const
     return std::make_unique<MetricThresholdCondition>(m_metric, m_threshold, m_comparison);
 }
 
+void MetricThresholdCondition::bindToReplicate(const ReplicateContext& context)
+{
+    // Follow the runner's metric to the instance updated by this replicate
+    auto it = context.metrics.find(m_metric.get());
+    if (it != context.metrics.end())
+    {
+        m_metric = it->second;
+    }
+}
+
 // =============================================================================
 // CompositeCondition
 // =============================================================================
@@ -477,6 +446,14 @@ std::unique_ptr<ITerminationCondition> CompositeCondition::clone() const
     return clone;
 }
 
+void CompositeCondition::bindToReplicate(const ReplicateContext& context)
+{
+    for (auto& cond : m_conditions)
+    {
+        cond->bindToReplicate(context);
+    }
+}
+
 // =============================================================================
 // MovingAverageSteadyStateCondition
 // =============================================================================
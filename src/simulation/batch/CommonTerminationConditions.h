@@ -48,6 +48,7 @@ public:
     bool shouldTerminate(physx::PxScene* scene, float time) const override;
     void reset() override;
     std::unique_ptr<ITerminationCondition> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override { m_bondManager = context.bondManager; }
 
 private:
     bonding::DynamicBondManager* m_bondManager;
@@ -78,12 +79,14 @@ private:
     mutable float m_lastTime = 0.0f;
 };
 
-/// Condition: Terminate when a ring is formed
+/// Condition: Terminate while the bond graph has a ring
+/// A ring that forms and later breaks no longer satisfies the condition.
 class RingFormationCondition : public ITerminationCondition
 {
 public:
     /// @param bondManager Reference to the bond manager
-    /// @param targetRingSize Size of ring to detect (0 = any size)
+    /// @param targetRingSize Size of ring to detect (0 = any size); the bond
+    ///        manager measures rings of at least this size exactly
     explicit RingFormationCondition(
         bonding::DynamicBondManager* bondManager,
         int targetRingSize = 0);
@@ -94,12 +97,14 @@ public:
     bool shouldTerminate(physx::PxScene* scene, float time) const override;
     void reset() override;
     std::unique_ptr<ITerminationCondition> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override;
 
 private:
     bonding::DynamicBondManager* m_bondManager;
     int m_targetRingSize;
 
-    bool detectRing(int& ringSize) const;
+    /// Raise the manager's ring size limit to the target size
+    void requireTargetRingSize();
 };
 
 /// Condition: Terminate when all entities are saturated
@@ -115,6 +120,7 @@ public:
     bool shouldTerminate(physx::PxScene* scene, float time) const override;
     void reset() override;
     std::unique_ptr<ITerminationCondition> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override { m_bondManager = context.bondManager; }
 
 private:
     bonding::DynamicBondManager* m_bondManager;
@@ -167,6 +173,7 @@ public:
     bool shouldTerminate(physx::PxScene* scene, float time) const override;
     void reset() override;
     std::unique_ptr<ITerminationCondition> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override;
 
 private:
     MetricPtr m_metric;
@@ -193,6 +200,7 @@ public:
     bool shouldTerminate(physx::PxScene* scene, float time) const override;
     void reset() override;
     std::unique_ptr<ITerminationCondition> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override;
 
 private:
     Logic m_logic;
@@ -5,6 +5,12 @@
 #include <variant>
 #include <vector>
 #include <memory>
+#include <unordered_map>
+
+namespace bonding
+{
+class DynamicBondManager;
+}
 
 namespace batch
 {
@@ -20,6 +26,20 @@ using MetricValue = std::variant<
     std::vector<int>
 >;
 
+class IMetric;
+
+/// Per-replicate state handed to metrics and termination conditions before a run
+/// The batch runner creates a fresh bond manager for every replicate, and in
+/// parallel mode each worker owns cloned metrics, so both need rebinding.
+struct ReplicateContext
+{
+    /// Bond manager owned by the replicate being run
+    bonding::DynamicBondManager* bondManager = nullptr;
+
+    /// Maps runner-level metrics to the instances used by this replicate
+    std::unordered_map<const IMetric*, std::shared_ptr<IMetric>> metrics;
+};
+
 /// Interface for simulation metrics
 /// Metrics track values throughout a simulation and provide final results
 class IMetric
@@ -54,6 +74,10 @@ public:
 
     /// Clone this metric
     virtual std::unique_ptr<IMetric> clone() const = 0;
+
+    /// Rebind replicate-specific references (e.g. the bond manager)
+    /// Called by the batch runner before each replicate
+    virtual void bindToReplicate(const ReplicateContext& context) { (void)context; }
 };
 
 /// Shared pointer type for metrics
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "IMetric.h"
 #include <PxPhysicsAPI.h>
 #include <string>
 #include <memory>
@@ -31,6 +32,10 @@ public:
 
     /// Clone this condition
     virtual std::unique_ptr<ITerminationCondition> clone() const = 0;
+
+    /// Rebind replicate-specific references (e.g. the bond manager)
+    /// Called by the batch runner before each replicate
+    virtual void bindToReplicate(const ReplicateContext& context) { (void)context; }
 };
 
 /// Shared pointer type for termination conditions
@@ -88,6 +88,16 @@ std::unique_ptr<ITerminationCondition> MSERSteadyStateCondition::clone() const
     return std::make_unique<MSERSteadyStateCondition>(m_metric, m_config);
 }
 
+void MSERSteadyStateCondition::bindToReplicate(const ReplicateContext& context)
+{
+    // Follow the runner's metric to the instance updated by this replicate
+    auto it = context.metrics.find(m_metric.get());
+    if (it != context.metrics.end())
+    {
+        m_metric = it->second;
+    }
+}
+
 double MSERSteadyStateCondition::computeMSER(size_t truncationPoint) const
 {
     if (truncationPoint >= m_samples.size())
@@ -48,6 +48,7 @@ public:
     bool shouldTerminate(physx::PxScene* scene, float time) const override;
     void reset() override;
     std::unique_ptr<ITerminationCondition> clone() const override;
+    void bindToReplicate(const ReplicateContext& context) override;
 
     /// Get the detected truncation point (sample index where steady state begins)
     size_t getTruncationPoint() const { return m_truncationPoint; }
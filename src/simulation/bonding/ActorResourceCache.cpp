@@ -0,0 +1,139 @@
+#include "ActorResourceCache.h"
+#include <cmath>
+#include <functional>
+
+namespace bonding
+{
+
+namespace
+{
+    inline void hashCombine(size_t& seed, size_t value)
+    {
+        seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+    }
+}
+
+size_t ActorResourceCache::KeyHash::operator()(const MaterialKey& key) const
+{
+    size_t seed = std::hash<int32_t>()(key.staticFriction);
+    hashCombine(seed, std::hash<int32_t>()(key.dynamicFriction));
+    hashCombine(seed, std::hash<int32_t>()(key.restitution));
+    return seed;
+}
+
+size_t ActorResourceCache::KeyHash::operator()(const ShapeKey& key) const
+{
+    size_t seed = std::hash<int>()(static_cast<int>(key.geomType));
+    for (int32_t dim : key.dims)
+    {
+        hashCombine(seed, std::hash<int32_t>()(dim));
+    }
+    hashCombine(seed, std::hash<const void*>()(key.material));
+    return seed;
+}
+
+int32_t ActorResourceCache::quantise(float value)
+{
+    return static_cast<int32_t>(std::lround(value / kQuantum));
+}
+
+physx::PxMaterial* ActorResourceCache::getMaterial(
+    physx::PxPhysics& physics, float staticFriction, float dynamicFriction, float restitution)
+{
+    MaterialKey key{quantise(staticFriction), quantise(dynamicFriction), quantise(restitution)};
+
+    auto it = m_materials.find(key);
+    if (it != m_materials.end())
+        return it->second;
+
+    physx::PxMaterial* material = physics.createMaterial(staticFriction, dynamicFriction, restitution);
+    if (material)
+    {
+        m_materials.emplace(key, material);
+    }
+    return material;
+}
+
+physx::PxShape* ActorResourceCache::getShape(physx::PxPhysics& physics, const ActorDef& def)
+{
+    physx::PxMaterial* material = getMaterial(
+        physics, def.staticFriction, def.dynamicFriction, def.restitution);
+    if (!material)
+        return nullptr;
+
+    // Unsupported geometry types share the default sphere's key
+    ShapeKey key{def.geomType, {0, 0, 0}, material};
+    switch (def.geomType)
+    {
+    case ActorDef::GeomType::SPHERE:
+        key.dims[0] = quantise(def.sphereRadius);
+        break;
+
+    case ActorDef::GeomType::BOX:
+        key.dims[0] = quantise(def.boxHalfX);
+        key.dims[1] = quantise(def.boxHalfY);
+        key.dims[2] = quantise(def.boxHalfZ);
+        break;
+
+    case ActorDef::GeomType::CAPSULE:
+        key.dims[0] = quantise(def.capsuleRadius);
+        key.dims[1] = quantise(def.capsuleHalfHeight);
+        break;
+
+    default:
+        key.geomType = ActorDef::GeomType::SPHERE;
+        key.dims[0] = quantise(0.5f);
+        break;
+    }
+
+    auto it = m_shapes.find(key);
+    if (it != m_shapes.end())
+        return it->second;
+
+    physx::PxShape* shape = nullptr;
+    switch (def.geomType)
+    {
+    case ActorDef::GeomType::SPHERE:
+        shape = physics.createShape(physx::PxSphereGeometry(def.sphereRadius), *material);
+        break;
+
+    case ActorDef::GeomType::BOX:
+        shape = physics.createShape(
+            physx::PxBoxGeometry(def.boxHalfX, def.boxHalfY, def.boxHalfZ), *material);
+        break;
+
+    case ActorDef::GeomType::CAPSULE:
+        shape = physics.createShape(
+            physx::PxCapsuleGeometry(def.capsuleRadius, def.capsuleHalfHeight), *material);
+        break;
+
+    default:
+        // Default to sphere
+        shape = physics.createShape(physx::PxSphereGeometry(0.5f), *material);
+        break;
+    }
+
+    if (shape)
+    {
+        m_shapes.emplace(key, shape);
+    }
+    return shape;
+}
+
+void ActorResourceCache::clear()
+{
+    // Shapes first: each holds a reference to its material
+    for (auto& [key, shape] : m_shapes)
+    {
+        shape->release();
+    }
+    m_shapes.clear();
+
+    for (auto& [key, material] : m_materials)
+    {
+        material->release();
+    }
+    m_materials.clear();
+}
+
+} // namespace bonding
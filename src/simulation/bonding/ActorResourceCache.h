@@ -0,0 +1,95 @@
+#pragma once
+
+#include "../SceneLoader.h"
+#include <PxPhysicsAPI.h>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+namespace bonding
+{
+
+/// Materials and shapes shared between actors with identical definitions
+/// Materials are keyed by (staticFriction, dynamicFriction, restitution) and
+/// shapes by geometry and material, with every value quantised to kQuantum so
+/// definitions that differ only by float noise map to the same object. Large
+/// scenes of identical particles then create a handful of materials and shapes
+/// instead of one of each per actor.
+///
+/// Shapes are created shared (non-exclusive): changing one, e.g. its filter
+/// data, changes it on every actor it is attached to.
+///
+/// The cache holds one reference to each object; actors using them hold their
+/// own. clear() must run before the PxPhysics the objects came from is released.
+class ActorResourceCache
+{
+public:
+    /// Quantisation step for material coefficients and geometry dimensions
+    static constexpr float kQuantum = 1.0e-4f;
+
+    ActorResourceCache() = default;
+    ~ActorResourceCache() = default;
+
+    // Disable copy (owns PhysX references)
+    ActorResourceCache(const ActorResourceCache&) = delete;
+    ActorResourceCache& operator=(const ActorResourceCache&) = delete;
+
+    /// Material with the given coefficients, created on first use
+    /// @return Cached material (owned by the cache), or nullptr on failure
+    physx::PxMaterial* getMaterial(
+        physx::PxPhysics& physics, float staticFriction, float dynamicFriction, float restitution);
+
+    /// Shared shape for an actor definition's geometry and material
+    /// Sphere, box and capsule are supported; other geometry types fall back to
+    /// a 0.5 sphere.
+    /// @return Cached shape (owned by the cache), or nullptr on failure
+    physx::PxShape* getShape(physx::PxPhysics& physics, const ActorDef& def);
+
+    /// Drop the cache's references
+    void clear();
+
+    size_t getMaterialCount() const { return m_materials.size(); }
+    size_t getShapeCount() const { return m_shapes.size(); }
+
+private:
+    struct MaterialKey
+    {
+        int32_t staticFriction;
+        int32_t dynamicFriction;
+        int32_t restitution;
+
+        bool operator==(const MaterialKey& other) const
+        {
+            return staticFriction == other.staticFriction &&
+                   dynamicFriction == other.dynamicFriction &&
+                   restitution == other.restitution;
+        }
+    };
+
+    struct ShapeKey
+    {
+        ActorDef::GeomType geomType;
+        int32_t dims[3];
+        const physx::PxMaterial* material;
+
+        bool operator==(const ShapeKey& other) const
+        {
+            return geomType == other.geomType &&
+                   dims[0] == other.dims[0] && dims[1] == other.dims[1] && dims[2] == other.dims[2] &&
+                   material == other.material;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const MaterialKey& key) const;
+        size_t operator()(const ShapeKey& key) const;
+    };
+
+    static int32_t quantise(float value);
+
+    std::unordered_map<MaterialKey, physx::PxMaterial*, KeyHash> m_materials;
+    std::unordered_map<ShapeKey, physx::PxShape*, KeyHash> m_shapes;
+};
+
+} // namespace bonding
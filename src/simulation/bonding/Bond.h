@@ -1,12 +1,17 @@
 #pragma once
 
 #include <PxPhysicsAPI.h>
-#include <string>
 #include <cstdint>
 
 namespace bonding
 {
 
+/// Interned bond type; names are resolved through DynamicBondManager
+using BondTypeId = uint16_t;
+
+/// Bond type ID that never refers to a registered type
+constexpr BondTypeId kInvalidBondType = 0xFFFF;
+
 /// Represents one endpoint of a bond
 struct BondEndpoint
 {
@@ -37,8 +42,8 @@ struct Bond
     /// The PhysX joint implementing this bond (owned by PhysX)
     physx::PxJoint* joint = nullptr;
 
-    /// Bond type identifier (e.g., "rigid", "compliant", "hinged")
-    std::string bondType = "rigid";
+    /// Bond type (e.g., "rigid", "compliant", "hinged"); see DynamicBondManager::getBondTypeName()
+    BondTypeId typeId = kInvalidBondType;
 
     /// Simulation time when the bond was formed
     float formationTime = 0.0f;
@@ -75,6 +80,10 @@ struct Bond
         if (!joint || pendingRemoval)
             return false;
 
+        // Broken by force; the joint keeps its actors until released
+        if (joint->getConstraintFlags() & physx::PxConstraintFlag::eBROKEN)
+            return false;
+
         // Check if joint still has valid actors
         physx::PxRigidActor* actor0 = nullptr;
         physx::PxRigidActor* actor1 = nullptr;
@@ -94,7 +103,7 @@ struct BondFormedEvent
 /// Event data for bond breaking
 struct BondBrokenEvent
 {
-    Bond bond;  // Copy since bond may be deleted
+    Bond bond;  // Copy since bond may be deleted (plain data, cheap to copy)
     float simulationTime;
     bool wasBreakForce;  // True if broken by force, false if manually removed
 };
@@ -0,0 +1,65 @@
+#include "BondBreakListener.h"
+
+namespace bonding
+{
+
+void BondBreakListener::takeBrokenJoints(std::vector<physx::PxJoint*>& out)
+{
+    out.clear();
+    out.swap(m_brokenJoints);
+}
+
+void BondBreakListener::clear()
+{
+    m_chained = nullptr;
+    m_brokenJoints.clear();
+}
+
+void BondBreakListener::onConstraintBreak(physx::PxConstraintInfo* constraints, physx::PxU32 count)
+{
+    for (physx::PxU32 i = 0; i < count; ++i)
+    {
+        // Joints from the extensions library carry the PxJoint as external reference
+        if (constraints[i].type == physx::PxConstraintExtIDs::eJOINT && constraints[i].externalReference)
+        {
+            m_brokenJoints.push_back(static_cast<physx::PxJoint*>(constraints[i].externalReference));
+        }
+    }
+
+    if (m_chained)
+        m_chained->onConstraintBreak(constraints, count);
+}
+
+void BondBreakListener::onWake(physx::PxActor** actors, physx::PxU32 count)
+{
+    if (m_chained)
+        m_chained->onWake(actors, count);
+}
+
+void BondBreakListener::onSleep(physx::PxActor** actors, physx::PxU32 count)
+{
+    if (m_chained)
+        m_chained->onSleep(actors, count);
+}
+
+void BondBreakListener::onContact(
+    const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, physx::PxU32 nbPairs)
+{
+    if (m_chained)
+        m_chained->onContact(pairHeader, pairs, nbPairs);
+}
+
+void BondBreakListener::onTrigger(physx::PxTriggerPair* pairs, physx::PxU32 count)
+{
+    if (m_chained)
+        m_chained->onTrigger(pairs, count);
+}
+
+void BondBreakListener::onAdvance(
+    const physx::PxRigidBody* const* bodyBuffer, const physx::PxTransform* poseBuffer, const physx::PxU32 count)
+{
+    if (m_chained)
+        m_chained->onAdvance(bodyBuffer, poseBuffer, count);
+}
+
+} // namespace bonding
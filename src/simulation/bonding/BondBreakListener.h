@@ -0,0 +1,50 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <vector>
+
+namespace bonding
+{
+
+/// Scene event callback that collects joints PhysX reports as broken
+/// DynamicBondManager installs it on its scene so only bonds that actually
+/// broke are processed each frame. Every event is also forwarded to the
+/// callback that was on the scene before, so application handlers (visual
+/// effects, recording) keep working.
+///
+/// PhysX calls it from fetchResults(); the manager drains it in update() on
+/// the same thread.
+class BondBreakListener : public physx::PxSimulationEventCallback
+{
+public:
+    BondBreakListener() = default;
+
+    // Disable copy (the scene holds a pointer to it)
+    BondBreakListener(const BondBreakListener&) = delete;
+    BondBreakListener& operator=(const BondBreakListener&) = delete;
+
+    /// Callback that receives every event after this one (may be null)
+    void setChainedCallback(physx::PxSimulationEventCallback* callback) { m_chained = callback; }
+    physx::PxSimulationEventCallback* getChainedCallback() const { return m_chained; }
+
+    /// Move the joints reported since the last call into out (replacing its contents)
+    void takeBrokenJoints(std::vector<physx::PxJoint*>& out);
+
+    /// Drop queued joints and the chained callback
+    void clear();
+
+    // --- PxSimulationEventCallback ---
+
+    void onConstraintBreak(physx::PxConstraintInfo* constraints, physx::PxU32 count) override;
+    void onWake(physx::PxActor** actors, physx::PxU32 count) override;
+    void onSleep(physx::PxActor** actors, physx::PxU32 count) override;
+    void onContact(const physx::PxContactPairHeader& pairHeader, const physx::PxContactPair* pairs, physx::PxU32 nbPairs) override;
+    void onTrigger(physx::PxTriggerPair* pairs, physx::PxU32 count) override;
+    void onAdvance(const physx::PxRigidBody* const* bodyBuffer, const physx::PxTransform* poseBuffer, const physx::PxU32 count) override;
+
+private:
+    physx::PxSimulationEventCallback* m_chained = nullptr;
+    std::vector<physx::PxJoint*> m_brokenJoints;
+};
+
+} // namespace bonding
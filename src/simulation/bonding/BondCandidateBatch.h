@@ -0,0 +1,116 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <vector>
+#include <cstdint>
+
+namespace bonding
+{
+
+class BondableEntity;
+
+/// A batch of candidate site pairs scored together by the formation rules
+/// Pair data is kept in parallel arrays, with world-space site positions and
+/// directions split per component so rules can process several pairs per
+/// instruction. Entries are in the order pairs were added; compact() keeps
+/// that order.
+struct BondCandidateBatch
+{
+    std::vector<const BondableEntity*> entity1;
+    std::vector<const BondableEntity*> entity2;
+    std::vector<uint32_t> site1;
+    std::vector<uint32_t> site2;
+
+    /// World-space site positions
+    std::vector<float> pos1X, pos1Y, pos1Z;
+    std::vector<float> pos2X, pos2Y, pos2Z;
+
+    /// World-space site directions
+    std::vector<float> dir1X, dir1Y, dir1Z;
+    std::vector<float> dir2X, dir2Y, dir2Z;
+
+    /// Combined score of the rules applied so far
+    std::vector<float> score;
+
+    size_t size() const { return score.size(); }
+    bool empty() const { return score.empty(); }
+
+    void clear()
+    {
+        forEachArray([](auto& array) { array.clear(); });
+    }
+
+    void reserve(size_t count)
+    {
+        forEachArray([count](auto& array) { array.reserve(count); });
+    }
+
+    /// Append a pair with a neutral score
+    void add(
+        const BondableEntity* e1, uint32_t s1, const physx::PxVec3& p1, const physx::PxVec3& d1,
+        const BondableEntity* e2, uint32_t s2, const physx::PxVec3& p2, const physx::PxVec3& d2)
+    {
+        entity1.push_back(e1);
+        entity2.push_back(e2);
+        site1.push_back(s1);
+        site2.push_back(s2);
+        pos1X.push_back(p1.x); pos1Y.push_back(p1.y); pos1Z.push_back(p1.z);
+        pos2X.push_back(p2.x); pos2Y.push_back(p2.y); pos2Z.push_back(p2.z);
+        dir1X.push_back(d1.x); dir1Y.push_back(d1.y); dir1Z.push_back(d1.z);
+        dir2X.push_back(d2.x); dir2Y.push_back(d2.y); dir2Z.push_back(d2.z);
+        score.push_back(1.0f);
+    }
+
+    /// Fold one rule's scores into the combined score and drop vetoed pairs
+    /// Same combination as evaluating rules one pair at a time:
+    /// negative vetoes, zero is neutral, positive scores multiply.
+    void applyRuleScores(const float* ruleScores)
+    {
+        const size_t count = size();
+        size_t kept = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            float ruleScore = ruleScores[i];
+            if (ruleScore < 0.0f)
+                continue;
+
+            float combined = score[i];
+            if (ruleScore > 0.0f)
+                combined *= ruleScore;
+
+            if (kept != i)
+                moveEntry(i, kept);
+            score[kept] = combined;
+            kept++;
+        }
+
+        if (kept != count)
+        {
+            forEachArray([kept](auto& array) { array.resize(kept); });
+        }
+    }
+
+private:
+    template<typename Fn>
+    void forEachArray(Fn&& fn)
+    {
+        fn(entity1); fn(entity2); fn(site1); fn(site2);
+        fn(pos1X); fn(pos1Y); fn(pos1Z); fn(pos2X); fn(pos2Y); fn(pos2Z);
+        fn(dir1X); fn(dir1Y); fn(dir1Z); fn(dir2X); fn(dir2Y); fn(dir2Z);
+        fn(score);
+    }
+
+    void moveEntry(size_t from, size_t to)
+    {
+        entity1[to] = entity1[from];
+        entity2[to] = entity2[from];
+        site1[to] = site1[from];
+        site2[to] = site2[from];
+        pos1X[to] = pos1X[from]; pos1Y[to] = pos1Y[from]; pos1Z[to] = pos1Z[from];
+        pos2X[to] = pos2X[from]; pos2Y[to] = pos2Y[from]; pos2Z[to] = pos2Z[from];
+        dir1X[to] = dir1X[from]; dir1Y[to] = dir1Y[from]; dir1Z[to] = dir1Z[from];
+        dir2X[to] = dir2X[from]; dir2Y[to] = dir2Y[from]; dir2Z[to] = dir2Z[from];
+    }
+};
+
+} // namespace bonding
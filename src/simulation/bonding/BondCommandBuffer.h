@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Bond.h"
+#include "IBondType.h"
+#include <PxPhysicsAPI.h>
+#include <vector>
+#include <cstdint>
+
+namespace bonding
+{
+
+/// Bond changes waiting to be applied to PhysX
+/// DynamicBondManager updates its own records (entities, bond store, graph)
+/// as soon as a bond is formed or broken, so later decisions in the same
+/// update see the new state. The PhysX side -- creating and releasing joints
+/// -- and the callbacks are queued here and applied together at the end of
+/// update(), which runs between fetchResults() and the next simulate().
+struct BondCommandBuffer
+{
+    /// A bond whose joint is still to be created
+    struct Formation
+    {
+        uint64_t bondId = 0;
+        IBondType* bondType = nullptr;
+        physx::PxRigidActor* actor1 = nullptr;
+        physx::PxRigidActor* actor2 = nullptr;
+        physx::PxTransform frame1{physx::PxIdentity};
+        physx::PxTransform frame2{physx::PxIdentity};
+        BondConfig config;
+        size_t formedIndex = 0;   ///< Entry in formed
+        bool countedAsFormed = false;   ///< Included in the frame's formed-bond count
+    };
+
+    std::vector<Formation> formations;
+
+    /// A joint of a broken bond
+    struct Release
+    {
+        physx::PxJoint* joint = nullptr;
+        BondTypeId poolType = kInvalidBondType;   ///< Pool it may go to; kInvalidBondType = release
+    };
+
+    /// Joints of broken bonds, pooled or released when the buffer is applied
+    std::vector<Release> releases;
+
+    /// Formed bonds to report; bondId is reset to 0 if the joint could not be created
+    std::vector<Bond> formed;
+
+    /// Broken bonds to report
+    std::vector<BondBrokenEvent> broken;
+
+    bool empty() const
+    {
+        return formations.empty() && releases.empty() && formed.empty() && broken.empty();
+    }
+
+    void clear()
+    {
+        formations.clear();
+        releases.clear();
+        formed.clear();
+        broken.clear();
+    }
+};
+
+/// Bond events applied together at the end of an update
+struct BondEventBatch
+{
+    std::vector<BondFormedEvent> formed;
+    std::vector<BondBrokenEvent> broken;
+};
+
+} // namespace bonding
@@ -2,6 +2,14 @@
 #include <algorithm>
 #include <cmath>
 
+// SSE2 is baseline on x64; other targets use the scalar loops
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BONDING_USE_SSE2 1
+#include <emmintrin.h>
+#else
+#define BONDING_USE_SSE2 0
+#endif
+
 namespace bonding
 {
 
@@ -37,6 +45,48 @@ float ProximityRule::evaluate(
     return 1.0f - normalizedDistance;
 }
 
+void ProximityRule::evaluateBatch(const BondCandidateBatch& batch, float* scores) const
+{
+    // Same operations and order as evaluate(), so both paths give identical scores
+    const size_t count = batch.size();
+    size_t i = 0;
+
+#if BONDING_USE_SSE2
+    const __m128 capture = _mm_set1_ps(m_captureDistance);
+    const __m128 minDistance = _mm_set1_ps(m_minDistance);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 veto = _mm_set1_ps(-1.0f);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(&batch.pos2X[i]), _mm_loadu_ps(&batch.pos1X[i]));
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(&batch.pos2Y[i]), _mm_loadu_ps(&batch.pos1Y[i]));
+        __m128 dz = _mm_sub_ps(_mm_loadu_ps(&batch.pos2Z[i]), _mm_loadu_ps(&batch.pos1Z[i]));
+
+        __m128 distance2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        __m128 distance = _mm_sqrt_ps(distance2);
+
+        __m128 score = _mm_sub_ps(one, _mm_div_ps(distance, capture));
+        __m128 rejected = _mm_or_ps(_mm_cmpgt_ps(distance, capture), _mm_cmplt_ps(distance, minDistance));
+
+        _mm_storeu_ps(scores + i, _mm_or_ps(_mm_and_ps(rejected, veto), _mm_andnot_ps(rejected, score)));
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        float dx = batch.pos2X[i] - batch.pos1X[i];
+        float dy = batch.pos2Y[i] - batch.pos1Y[i];
+        float dz = batch.pos2Z[i] - batch.pos1Z[i];
+        float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+
+        if (distance > m_captureDistance || distance < m_minDistance)
+            scores[i] = -1.0f;
+        else
+            scores[i] = 1.0f - distance / m_captureDistance;
+    }
+}
+
 std::string ProximityRule::getDescription() const
 {
     return "Sites must be within " + std::to_string(m_captureDistance) + " distance units";
@@ -89,6 +139,71 @@ float DirectionalAlignmentRule::evaluate(
     return 1.0f - (angleDiff / m_angleTolerance);
 }
 
+void DirectionalAlignmentRule::evaluateBatch(const BondCandidateBatch& batch, float* scores) const
+{
+    const size_t count = batch.size();
+
+    if (m_mode != AlignmentMode::ANTIPARALLEL && m_mode != AlignmentMode::PARALLEL)
+    {
+        std::fill(scores, scores + count, 1.0f);
+        return;
+    }
+
+    const float targetDot = (m_mode == AlignmentMode::ANTIPARALLEL) ? -1.0f : 1.0f;
+
+    // Scored exactly as in evaluate()
+    auto scoreAligned = [this](float aligned)
+    {
+        float angleDiff = std::acos(std::clamp(aligned, -1.0f, 1.0f));
+        if (angleDiff > m_angleTolerance)
+            return -1.0f;
+        return 1.0f - (angleDiff / m_angleTolerance);
+    };
+
+    // acos is decreasing on [-1, 1], so pairs clearly below cos(tolerance) are
+    // vetoed without calling it; pairs near the boundary take the exact path
+    const float vetoBelow = (m_angleTolerance < physx::PxPi)
+        ? std::cos(m_angleTolerance) - 1e-4f
+        : -2.0f;
+
+    size_t i = 0;
+
+#if BONDING_USE_SSE2
+    const __m128 target = _mm_set1_ps(targetDot);
+    const __m128 threshold = _mm_set1_ps(vetoBelow);
+
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 dot = _mm_add_ps(
+            _mm_add_ps(
+                _mm_mul_ps(_mm_loadu_ps(&batch.dir1X[i]), _mm_loadu_ps(&batch.dir2X[i])),
+                _mm_mul_ps(_mm_loadu_ps(&batch.dir1Y[i]), _mm_loadu_ps(&batch.dir2Y[i]))),
+            _mm_mul_ps(_mm_loadu_ps(&batch.dir1Z[i]), _mm_loadu_ps(&batch.dir2Z[i])));
+        __m128 aligned = _mm_mul_ps(dot, target);
+
+        int vetoMask = _mm_movemask_ps(_mm_cmplt_ps(aligned, threshold));
+        if (vetoMask == 0xF)
+        {
+            _mm_storeu_ps(scores + i, _mm_set1_ps(-1.0f));
+            continue;
+        }
+
+        _mm_storeu_ps(scores + i, aligned);
+        for (size_t lane = 0; lane < 4; ++lane)
+        {
+            scores[i + lane] = (vetoMask & (1 << lane)) ? -1.0f : scoreAligned(scores[i + lane]);
+        }
+    }
+#endif
+
+    for (; i < count; ++i)
+    {
+        float dot = batch.dir1X[i] * batch.dir2X[i] + batch.dir1Y[i] * batch.dir2Y[i] + batch.dir1Z[i] * batch.dir2Z[i];
+        float aligned = dot * targetDot;
+        scores[i] = (aligned < vetoBelow) ? -1.0f : scoreAligned(aligned);
+    }
+}
+
 std::string DirectionalAlignmentRule::getDescription() const
 {
     std::string modeStr;
@@ -116,15 +231,25 @@ float TypeCompatibilityRule::evaluate(
     const BondableEntity& e1, uint32_t s1,
     const BondableEntity& e2, uint32_t s2) const
 {
-    const BondingSiteDef* site1 = e1.getSiteDef(s1);
-    const BondingSiteDef* site2 = e2.getSiteDef(s2);
+    const int32_t index1 = e1.getSiteIndex(s1);
+    const int32_t index2 = e2.getSiteIndex(s2);
 
-    if (!site1 || !site2)
+    if (index1 < 0 || index2 < 0)
         return -1.0f;
 
+    // Types interned in the same registry: compare bit masks
+    const SiteTypeMask& mask1 = e1.getSiteTypeMask(index1);
+    const SiteTypeMask& mask2 = e2.getSiteTypeMask(index2);
+    if (mask1.isInterned() && mask2.isInterned() &&
+        e1.getTemplate()->getSiteTypeRegistryId() == e2.getTemplate()->getSiteTypeRegistryId())
+        return areSiteTypesCompatible(mask1, mask2) ? 1.0f : -1.0f;
+
+    const BondingSiteDef& site1 = e1.getAllSites()[index1];
+    const BondingSiteDef& site2 = e2.getAllSites()[index2];
+
     // Check bidirectional compatibility
-    bool compatible = site1->isCompatibleWith(site2->siteType) &&
-                      site2->isCompatibleWith(site1->siteType);
+    bool compatible = site1.isCompatibleWith(site2.siteType) &&
+                      site2.isCompatibleWith(site1.siteType);
 
     return compatible ? 1.0f : -1.0f;
 }
@@ -211,34 +336,13 @@ bool CoplanarityRule::computeBondPlane(
     const BondableEntity& entity,
     physx::PxVec3& planeNormal) const
 {
-    // Need at least 2 bonds to define a plane
-    if (entity.getTotalBondCount() < 2)
-        return false;
-
-    // Get all bond directions
-    std::vector<physx::PxVec3> directions;
-    physx::PxVec3 entityPos = entity.getWorldTransform().p;
-
-    for (const auto& site : entity.getAllSites())
-    {
-        auto bonds = entity.getBondsAt(site.siteId);
-        for (auto bondId : bonds)
-        {
-            physx::PxVec3 sitePos = entity.getSiteWorldPosition(site.siteId);
-            physx::PxVec3 dir = (sitePos - entityPos).getNormalized();
-            if (dir.magnitude() > 0.001f)
-            {
-                directions.push_back(dir);
-            }
-        }
-    }
-
-    if (directions.size() < 2)
+    // The entity keeps the plane in its local frame; only the pose is per check
+    physx::PxVec3 localNormal;
+    if (!entity.getLocalBondPlane(localNormal))
         return false;
 
-    // Compute plane normal from first two bond directions
-    planeNormal = directions[0].cross(directions[1]).getNormalized();
-    return planeNormal.magnitude() > 0.001f;
+    planeNormal = entity.getWorldTransform().q.rotate(localNormal);
+    return true;
 }
 
 std::string CoplanarityRule::getDescription() const
@@ -267,77 +371,69 @@ float AngleConstraintRule::evaluate(
     physx::PxVec3 proposedDir = (pos2 - pos1).getNormalized();
 
     // Check against existing bonds from entity 1
-    auto existingDirs1 = getExistingBondDirections(e1, s1);
-    for (const auto& existingDir : existingDirs1)
-    {
-        float dot = proposedDir.dot(existingDir);
-        float angle = std::acos(std::clamp(dot, -1.0f, 1.0f));
-        float diff = std::abs(angle - m_targetAngle);
-
-        if (diff > m_tolerance)
-            return -1.0f;
-    }
+    bool hasBonds1, hasBonds2;
+    float bestDiff1, bestDiff2;
+    if (!checkExistingBondAngles(e1, s1, proposedDir, hasBonds1, bestDiff1))
+        return -1.0f;
 
     // Check against existing bonds from entity 2
-    physx::PxVec3 reversedDir = -proposedDir;
-    auto existingDirs2 = getExistingBondDirections(e2, s2);
-    for (const auto& existingDir : existingDirs2)
-    {
-        float dot = reversedDir.dot(existingDir);
-        float angle = std::acos(std::clamp(dot, -1.0f, 1.0f));
-        float diff = std::abs(angle - m_targetAngle);
-
-        if (diff > m_tolerance)
-            return -1.0f;
-    }
+    if (!checkExistingBondAngles(e2, s2, -proposedDir, hasBonds2, bestDiff2))
+        return -1.0f;
 
     // If no existing bonds, allow formation
-    if (existingDirs1.empty() && existingDirs2.empty())
+    if (!hasBonds1 && !hasBonds2)
         return 1.0f;
 
     // Score based on how close to target angle
     float score = 1.0f;
-    if (!existingDirs1.empty())
+    if (hasBonds1)
     {
-        float bestDiff = m_tolerance;
-        for (const auto& existingDir : existingDirs1)
-        {
-            float dot = proposedDir.dot(existingDir);
-            float angle = std::acos(std::clamp(dot, -1.0f, 1.0f));
-            bestDiff = std::min(bestDiff, std::abs(angle - m_targetAngle));
-        }
-        score *= 1.0f - (bestDiff / m_tolerance);
+        score *= 1.0f - (bestDiff1 / m_tolerance);
     }
 
     return score;
 }
 
-std::vector<physx::PxVec3> AngleConstraintRule::getExistingBondDirections(
+bool AngleConstraintRule::checkExistingBondAngles(
     const BondableEntity& entity,
-    uint32_t siteId) const
+    uint32_t siteId,
+    const physx::PxVec3& proposedDir,
+    bool& hasBonds,
+    float& bestDiff) const
 {
-    std::vector<physx::PxVec3> directions;
-    physx::PxVec3 sitePos = entity.getSiteWorldPosition(siteId);
+    hasBonds = false;
+    bestDiff = m_tolerance;
+
+    const int32_t siteIndex = entity.getSiteIndex(siteId);
+    if (siteIndex < 0)
+        return true;
+
+    // Compare in the entity's local frame: one rotation instead of one per bond
+    const physx::PxVec3 localProposedDir = entity.getWorldTransform().q.rotateInv(proposedDir);
+    const physx::PxVec3& sitePos = entity.getSiteLocalPosition(siteIndex);
 
-    // Get directions to all bonded sites on this entity
-    for (const auto& site : entity.getAllSites())
+    // Directions to all other bonded sites on this entity
+    for (uint32_t index : entity.getBondedSiteIndices())
     {
-        if (site.siteId == siteId)
+        if (index == static_cast<uint32_t>(siteIndex))
             continue;
 
-        auto bonds = entity.getBondsAt(site.siteId);
-        if (!bonds.empty())
-        {
-            physx::PxVec3 otherSitePos = entity.getSiteWorldPosition(site.siteId);
-            physx::PxVec3 dir = (otherSitePos - sitePos).getNormalized();
-            if (dir.magnitude() > 0.001f)
-            {
-                directions.push_back(dir);
-            }
-        }
+        physx::PxVec3 dir = (entity.getSiteLocalPosition(index) - sitePos).getNormalized();
+        if (dir.magnitude() <= 0.001f)
+            continue;
+
+        float dot = localProposedDir.dot(dir);
+        float angle = std::acos(std::clamp(dot, -1.0f, 1.0f));
+        float diff = std::abs(angle - m_targetAngle);
+
+        if (diff > m_tolerance)
+            return false;
+
+        hasBonds = true;
+        bestDiff = std::min(bestDiff, diff);
     }
 
-    return directions;
+    return true;
 }
 
 std::string AngleConstraintRule::getDescription() const
@@ -19,6 +19,8 @@ public:
         const BondableEntity& e1, uint32_t s1,
         const BondableEntity& e2, uint32_t s2) const override;
 
+    void evaluateBatch(const BondCandidateBatch& batch, float* scores) const override;
+
     int getPriority() const override { return 100; } // High priority - check first
     std::string getName() const override { return "proximity"; }
     std::string getDescription() const override;
@@ -54,6 +56,8 @@ public:
         const BondableEntity& e1, uint32_t s1,
         const BondableEntity& e2, uint32_t s2) const override;
 
+    void evaluateBatch(const BondCandidateBatch& batch, float* scores) const override;
+
     int getPriority() const override { return 80; }
     std::string getName() const override { return "directional_alignment"; }
     std::string getDescription() const override;
@@ -114,7 +118,7 @@ public:
 private:
     float m_maxDeviationAngle;
 
-    // Helper to compute plane normal from existing bonds
+    // Helper to get the world plane normal of existing bonds
     bool computeBondPlane(
         const BondableEntity& entity,
         physx::PxVec3& planeNormal) const;
@@ -146,10 +150,15 @@ private:
     float m_targetAngle;
     float m_tolerance;
 
-    // Helper to get existing bond directions
-    std::vector<physx::PxVec3> getExistingBondDirections(
+    // Helper to check a proposed bond against the entity's existing bonds
+    // @return False if any angle is out of tolerance; otherwise bestDiff is the
+    //         smallest deviation from the target (m_tolerance if no bonds)
+    bool checkExistingBondAngles(
         const BondableEntity& entity,
-        uint32_t siteId) const;
+        uint32_t siteId,
+        const physx::PxVec3& proposedDir,
+        bool& hasBonds,
+        float& bestDiff) const;
 };
 
 /// Rule: Prevent self-bonding (entity bonding to itself)
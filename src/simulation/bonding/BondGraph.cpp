@@ -0,0 +1,99 @@
+#include "BondGraph.h"
+
+namespace bonding
+{
+
+void BondGraph::clearEdges()
+{
+    for (auto& [entityId, edges] : m_adjacency)
+    {
+        edges.clear();
+    }
+    m_edgeCount = 0;
+}
+
+void BondGraph::removeNode(uint64_t entityId)
+{
+    auto it = m_adjacency.find(entityId);
+    if (it == m_adjacency.end())
+        return;
+
+    for (const BondEdge& edge : it->second)
+    {
+        if (edge.neighborId != entityId)
+        {
+            auto neighborIt = m_adjacency.find(edge.neighborId);
+            if (neighborIt != m_adjacency.end())
+            {
+                eraseEdge(neighborIt->second, edge.bondId);
+            }
+        }
+        m_edgeCount--;
+    }
+
+    m_adjacency.erase(it);
+}
+
+void BondGraph::addEdge(const Bond& bond)
+{
+    const uint64_t id1 = bond.endpoint1.entityId;
+    const uint64_t id2 = bond.endpoint2.entityId;
+
+    m_adjacency[id1].push_back({id2, bond.bondId});
+    if (id2 != id1)
+    {
+        m_adjacency[id2].push_back({id1, bond.bondId});
+    }
+    m_edgeCount++;
+}
+
+void BondGraph::removeEdge(const Bond& bond)
+{
+    const uint64_t id1 = bond.endpoint1.entityId;
+    const uint64_t id2 = bond.endpoint2.entityId;
+
+    bool removed = false;
+    auto it1 = m_adjacency.find(id1);
+    if (it1 != m_adjacency.end())
+    {
+        removed = eraseEdge(it1->second, bond.bondId);
+    }
+    if (id2 != id1)
+    {
+        auto it2 = m_adjacency.find(id2);
+        if (it2 != m_adjacency.end())
+        {
+            removed = eraseEdge(it2->second, bond.bondId) || removed;
+        }
+    }
+
+    if (removed)
+    {
+        m_edgeCount--;
+    }
+}
+
+const std::vector<BondEdge>& BondGraph::getEdges(uint64_t entityId) const
+{
+    static const std::vector<BondEdge> kNoEdges;
+
+    auto it = m_adjacency.find(entityId);
+    return (it != m_adjacency.end()) ? it->second : kNoEdges;
+}
+
+bool BondGraph::eraseEdge(std::vector<BondEdge>& edges, uint64_t bondId)
+{
+    // Degrees are bounded by site valency, so a linear search is cheap.
+    // Order is kept so walks visit neighbours in bond formation order.
+    for (auto it = edges.begin(); it != edges.end(); ++it)
+    {
+        if (it->bondId == bondId)
+        {
+            edges.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace bonding
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Bond.h"
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace bonding
+{
+
+/// One bond as seen from one of its entities
+struct BondEdge
+{
+    uint64_t neighborId = 0;  ///< Entity at the other end (the entity itself for a self-bond)
+    uint64_t bondId = 0;
+};
+
+/// Entity adjacency of the current bond set
+/// Kept up to date by DynamicBondManager as bonds form and break, so queries
+/// about one entity's bonds, and graph walks over the whole structure, never
+/// have to scan the bond map. Every registered entity is a node, bonded or not.
+/// A bond appears in the edge list of both its entities; a bond from an entity
+/// to itself appears once.
+class BondGraph
+{
+public:
+    using AdjacencyMap = std::unordered_map<uint64_t, std::vector<BondEdge>>;
+
+    BondGraph() = default;
+
+    /// Remove all nodes and edges
+    void clear() { m_adjacency.clear(); m_edgeCount = 0; }
+
+    /// Remove all edges, keeping the nodes
+    void clearEdges();
+
+    /// Reserve storage for a number of entities
+    void reserve(size_t nodeCount) { m_adjacency.reserve(nodeCount); }
+
+    /// Add an entity with no edges (no-op if present)
+    void addNode(uint64_t entityId) { m_adjacency.try_emplace(entityId); }
+
+    /// Remove an entity and every edge touching it
+    void removeNode(uint64_t entityId);
+
+    /// Add the edge for a bond; missing endpoints are added as nodes
+    void addEdge(const Bond& bond);
+
+    /// Remove the edge for a bond (no-op if absent)
+    void removeEdge(const Bond& bond);
+
+    /// Check whether an entity is a node
+    bool hasNode(uint64_t entityId) const { return m_adjacency.count(entityId) != 0; }
+
+    /// Edges of an entity; empty for unknown entities
+    const std::vector<BondEdge>& getEdges(uint64_t entityId) const;
+
+    /// Number of bonds touching an entity
+    size_t getDegree(uint64_t entityId) const { return getEdges(entityId).size(); }
+
+    /// Number of nodes
+    size_t getNodeCount() const { return m_adjacency.size(); }
+
+    /// Number of edges (bonds)
+    size_t getEdgeCount() const { return m_edgeCount; }
+
+    /// All nodes with their edges
+    const AdjacencyMap& getAdjacency() const { return m_adjacency; }
+
+private:
+    AdjacencyMap m_adjacency;
+    size_t m_edgeCount = 0;
+
+    /// Remove the entry for a bond from one entity's edge list
+    static bool eraseEdge(std::vector<BondEdge>& edges, uint64_t bondId);
+};
+
+} // namespace bonding
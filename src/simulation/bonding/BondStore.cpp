@@ -0,0 +1,111 @@
+#include "BondStore.h"
+
+namespace bonding
+{
+
+void BondStore::clear()
+{
+    // Retire every live slot so old IDs stay invalid
+    for (uint32_t slot : m_denseSlots)
+    {
+        if (++m_slotGeneration[slot] == 0)
+            m_slotGeneration[slot] = 1;
+        m_slotDense[slot] = kNoIndex;
+        m_freeSlots.push_back(slot);
+    }
+
+    m_bonds.clear();
+    m_joints.clear();
+    m_denseSlots.clear();
+}
+
+void BondStore::reserve(size_t bondCount)
+{
+    m_bonds.reserve(bondCount);
+    m_joints.reserve(bondCount);
+    m_denseSlots.reserve(bondCount);
+    m_slotDense.reserve(bondCount);
+    m_slotGeneration.reserve(bondCount);
+}
+
+uint64_t BondStore::insert(const Bond& bond)
+{
+    uint32_t slot;
+    if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        slot = static_cast<uint32_t>(m_slotDense.size());
+        m_slotDense.push_back(kNoIndex);
+        m_slotGeneration.push_back(1);
+    }
+
+    const uint64_t bondId = (static_cast<uint64_t>(m_slotGeneration[slot]) << 32) | slot;
+
+    m_slotDense[slot] = static_cast<uint32_t>(m_bonds.size());
+    m_bonds.push_back(bond);
+    m_bonds.back().bondId = bondId;
+    m_joints.push_back(bond.joint);
+    m_denseSlots.push_back(slot);
+
+    return bondId;
+}
+
+bool BondStore::erase(uint64_t bondId)
+{
+    const uint32_t index = denseIndexOf(bondId);
+    if (index == kNoIndex)
+        return false;
+
+    const uint32_t slot = slotOf(bondId);
+    const uint32_t last = static_cast<uint32_t>(m_bonds.size() - 1);
+
+    // Move the last record into the hole
+    if (index != last)
+    {
+        m_bonds[index] = m_bonds[last];
+        m_joints[index] = m_joints[last];
+        m_denseSlots[index] = m_denseSlots[last];
+        m_slotDense[m_denseSlots[index]] = index;
+    }
+    m_bonds.pop_back();
+    m_joints.pop_back();
+    m_denseSlots.pop_back();
+
+    if (++m_slotGeneration[slot] == 0)
+        m_slotGeneration[slot] = 1;
+    m_slotDense[slot] = kNoIndex;
+    m_freeSlots.push_back(slot);
+
+    return true;
+}
+
+const Bond* BondStore::find(uint64_t bondId) const
+{
+    const uint32_t index = denseIndexOf(bondId);
+    return (index != kNoIndex) ? &m_bonds[index] : nullptr;
+}
+
+void BondStore::setJoint(uint64_t bondId, physx::PxJoint* joint)
+{
+    const uint32_t index = denseIndexOf(bondId);
+    if (index == kNoIndex)
+        return;
+
+    m_bonds[index].joint = joint;
+    m_joints[index] = joint;
+}
+
+uint32_t BondStore::denseIndexOf(uint64_t bondId) const
+{
+    const uint32_t slot = slotOf(bondId);
+    if (slot >= m_slotDense.size() || m_slotGeneration[slot] != generationOf(bondId))
+        return kNoIndex;
+
+    return m_slotDense[slot];
+}
+
+} // namespace bonding
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Bond.h"
+#include <PxPhysicsAPI.h>
+#include <vector>
+#include <cstdint>
+
+namespace bonding
+{
+
+/// Slot map holding all live bonds
+/// A bond ID is a handle: the low 32 bits select a slot, the high 32 bits hold
+/// the slot's generation. Removing a bond bumps the generation, so an ID kept
+/// after its bond is gone never resolves to a newer bond in the same slot.
+///
+/// Bond records are packed densely (removal swaps the last record into the
+/// hole), and the joint pointers are also kept in their own contiguous array in
+/// the same order, so per-frame passes over joints touch nothing else.
+/// Dense order is not stable across removals; use IDs to refer to bonds.
+class BondStore
+{
+public:
+    BondStore() = default;
+
+    /// Remove all bonds; IDs handed out before stay invalid
+    void clear();
+
+    /// Reserve storage for a number of bonds
+    void reserve(size_t bondCount);
+
+    /// Add a bond; its bondId is assigned here
+    /// @return The new bond ID (never 0)
+    uint64_t insert(const Bond& bond);
+
+    /// Remove a bond
+    /// @return False if the ID does not refer to a live bond
+    bool erase(uint64_t bondId);
+
+    /// Find a live bond, or nullptr
+    const Bond* find(uint64_t bondId) const;
+
+    /// Check whether an ID refers to a live bond
+    bool contains(uint64_t bondId) const { return denseIndexOf(bondId) != kNoIndex; }
+
+    /// Set the joint of a live bond
+    void setJoint(uint64_t bondId, physx::PxJoint* joint);
+
+    /// Number of live bonds
+    size_t size() const { return m_bonds.size(); }
+    bool empty() const { return m_bonds.empty(); }
+
+    /// Bond at a dense index in [0, size())
+    const Bond& at(size_t index) const { return m_bonds[index]; }
+
+    /// Joints in dense order (parallel to at())
+    const std::vector<physx::PxJoint*>& getJoints() const { return m_joints; }
+
+    /// Iterate live bonds in dense order
+    std::vector<Bond>::const_iterator begin() const { return m_bonds.begin(); }
+    std::vector<Bond>::const_iterator end() const { return m_bonds.end(); }
+
+    /// Slot and generation packed into a bond ID
+    static uint32_t slotOf(uint64_t bondId) { return static_cast<uint32_t>(bondId); }
+    static uint32_t generationOf(uint64_t bondId) { return static_cast<uint32_t>(bondId >> 32); }
+
+private:
+    static constexpr uint32_t kNoIndex = 0xFFFFFFFFu;
+
+    // Dense storage
+    std::vector<Bond> m_bonds;
+    std::vector<physx::PxJoint*> m_joints;
+    std::vector<uint32_t> m_denseSlots;      ///< Dense index -> slot
+
+    // Per-slot state
+    std::vector<uint32_t> m_slotDense;       ///< Slot -> dense index, or kNoIndex if free
+    std::vector<uint32_t> m_slotGeneration;  ///< Current generation; starts at 1
+    std::vector<uint32_t> m_freeSlots;
+
+    /// Dense index of a live bond, or kNoIndex
+    uint32_t denseIndexOf(uint64_t bondId) const;
+};
+
+} // namespace bonding
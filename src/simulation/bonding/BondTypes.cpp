@@ -8,6 +8,26 @@ namespace {
     T clampValue(T value, T minVal, T maxVal) {
         return (value < minVal) ? minVal : ((value > maxVal) ? maxVal : value);
     }
+
+    // Settings shared by every bond type. Unbreakable bonds get an infinite
+    // threshold explicitly so a pooled joint drops its previous one.
+    void applyCommonSettings(physx::PxJoint& joint, const bonding::BondConfig& config) {
+        if (config.breakable)
+            joint.setBreakForce(config.breakForce, config.breakTorque);
+        else
+            joint.setBreakForce(PX_MAX_F32, PX_MAX_F32);
+
+        joint.setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, config.enableCollision);
+    }
+
+    // Move a pooled joint onto new actors and frames
+    void rebindJoint(physx::PxJoint& joint,
+                     physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+                     physx::PxRigidActor* actor2, const physx::PxTransform& frame2) {
+        joint.setActors(actor1, actor2);
+        joint.setLocalPose(physx::PxJointActorIndex::eACTOR0, frame1);
+        joint.setLocalPose(physx::PxJointActorIndex::eACTOR1, frame2);
+    }
 }
 
 namespace bonding
@@ -39,18 +59,30 @@ physx::PxJoint* RigidBondType::createJoint(
     if (!joint)
         return nullptr;
 
-    // Configure break force if breakable
-    if (config.breakable)
-    {
-        joint->setBreakForce(config.breakForce, config.breakTorque);
-    }
-
-    // Configure collision
-    joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, config.enableCollision);
+    applyCommonSettings(*joint, config);
 
     return joint;
 }
 
+bool RigidBondType::reconfigureJoint(
+    physx::PxJoint* joint,
+    physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+    physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+    const Bond& bond,
+    const BondConfig& config) const
+{
+    (void)bond;
+
+    physx::PxFixedJoint* fixedJoint = joint ? joint->is<physx::PxFixedJoint>() : nullptr;
+    if (!fixedJoint)
+        return false;
+
+    rebindJoint(*fixedJoint, actor1, frame1, actor2, frame2);
+    applyCommonSettings(*fixedJoint, config);
+
+    return true;
+}
+
 JointDef RigidBondType::getJointDef(const Bond& bond, const BondConfig& config) const
 {
     (void)bond;
@@ -101,6 +133,36 @@ physx::PxJoint* CompliantBondType::createJoint(
     if (!joint)
         return nullptr;
 
+    configureJoint(*joint, actor1, frame1, actor2, frame2, config);
+
+    return joint;
+}
+
+bool CompliantBondType::reconfigureJoint(
+    physx::PxJoint* joint,
+    physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+    physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+    const Bond& bond,
+    const BondConfig& config) const
+{
+    (void)bond;
+
+    physx::PxDistanceJoint* distanceJoint = joint ? joint->is<physx::PxDistanceJoint>() : nullptr;
+    if (!distanceJoint)
+        return false;
+
+    rebindJoint(*distanceJoint, actor1, frame1, actor2, frame2);
+    configureJoint(*distanceJoint, actor1, frame1, actor2, frame2, config);
+
+    return true;
+}
+
+void CompliantBondType::configureJoint(
+    physx::PxDistanceJoint& joint,
+    physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+    physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+    const BondConfig& config) const
+{
     // Calculate rest length if not specified
     float restLength = config.restLength;
     if (restLength <= 0.0f)
@@ -119,24 +181,16 @@ physx::PxJoint* CompliantBondType::createJoint(
     float minDist = (config.minDistance > 0.0f) ? config.minDistance : restLength * 0.9f;
     float maxDist = (config.maxDistance > 0.0f) ? config.maxDistance : restLength * 1.1f;
 
-    joint->setMinDistance(minDist);
-    joint->setMaxDistance(maxDist);
-    joint->setDistanceJointFlag(physx::PxDistanceJointFlag::eMIN_DISTANCE_ENABLED, true);
-    joint->setDistanceJointFlag(physx::PxDistanceJointFlag::eMAX_DISTANCE_ENABLED, true);
-    joint->setDistanceJointFlag(physx::PxDistanceJointFlag::eSPRING_ENABLED, true);
+    joint.setMinDistance(minDist);
+    joint.setMaxDistance(maxDist);
+    joint.setDistanceJointFlag(physx::PxDistanceJointFlag::eMIN_DISTANCE_ENABLED, true);
+    joint.setDistanceJointFlag(physx::PxDistanceJointFlag::eMAX_DISTANCE_ENABLED, true);
+    joint.setDistanceJointFlag(physx::PxDistanceJointFlag::eSPRING_ENABLED, true);
 
-    joint->setStiffness(stiffness);
-    joint->setDamping(damping);
+    joint.setStiffness(stiffness);
+    joint.setDamping(damping);
 
-    // Configure break force if breakable
-    if (config.breakable)
-    {
-        joint->setBreakForce(config.breakForce, config.breakTorque);
-    }
-
-    joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, config.enableCollision);
-
-    return joint;
+    applyCommonSettings(joint, config);
 }
 
 JointDef CompliantBondType::getJointDef(const Bond& bond, const BondConfig& config) const
@@ -226,22 +280,43 @@ physx::PxJoint* HingedBondType::createJoint(
     if (!joint)
         return nullptr;
 
+    configureJoint(*joint, config);
+
+    return joint;
+}
+
+bool HingedBondType::reconfigureJoint(
+    physx::PxJoint* joint,
+    physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+    physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+    const Bond& bond,
+    const BondConfig& config) const
+{
+    (void)bond;
+
+    physx::PxRevoluteJoint* revoluteJoint = joint ? joint->is<physx::PxRevoluteJoint>() : nullptr;
+    if (!revoluteJoint)
+        return false;
+
+    physx::PxQuat axisRot = computeAxisRotation();
+    rebindJoint(*revoluteJoint,
+        actor1, physx::PxTransform(frame1.p, frame1.q * axisRot),
+        actor2, physx::PxTransform(frame2.p, frame2.q * axisRot));
+    configureJoint(*revoluteJoint, config);
+
+    return true;
+}
+
+void HingedBondType::configureJoint(physx::PxRevoluteJoint& joint, const BondConfig& config) const
+{
     // Configure limits
     if (m_enableLimits)
     {
-        joint->setLimit(physx::PxJointAngularLimitPair(m_lowerLimit, m_upperLimit));
-        joint->setRevoluteJointFlag(physx::PxRevoluteJointFlag::eLIMIT_ENABLED, true);
+        joint.setLimit(physx::PxJointAngularLimitPair(m_lowerLimit, m_upperLimit));
     }
+    joint.setRevoluteJointFlag(physx::PxRevoluteJointFlag::eLIMIT_ENABLED, m_enableLimits);
 
-    // Configure break force if breakable
-    if (config.breakable)
-    {
-        joint->setBreakForce(config.breakForce, config.breakTorque);
-    }
-
-    joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, config.enableCollision);
-
-    return joint;
+    applyCommonSettings(joint, config);
 }
 
 JointDef HingedBondType::getJointDef(const Bond& bond, const BondConfig& config) const
@@ -301,22 +376,40 @@ physx::PxJoint* BallSocketBondType::createJoint(
     if (!joint)
         return nullptr;
 
+    configureJoint(*joint, config);
+
+    return joint;
+}
+
+bool BallSocketBondType::reconfigureJoint(
+    physx::PxJoint* joint,
+    physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+    physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+    const Bond& bond,
+    const BondConfig& config) const
+{
+    (void)bond;
+
+    physx::PxSphericalJoint* sphericalJoint = joint ? joint->is<physx::PxSphericalJoint>() : nullptr;
+    if (!sphericalJoint)
+        return false;
+
+    rebindJoint(*sphericalJoint, actor1, frame1, actor2, frame2);
+    configureJoint(*sphericalJoint, config);
+
+    return true;
+}
+
+void BallSocketBondType::configureJoint(physx::PxSphericalJoint& joint, const BondConfig& config) const
+{
     // Configure cone limit
     if (m_enableConeLimit)
     {
-        joint->setLimitCone(physx::PxJointLimitCone(m_coneAngle, m_coneAngle));
-        joint->setSphericalJointFlag(physx::PxSphericalJointFlag::eLIMIT_ENABLED, true);
+        joint.setLimitCone(physx::PxJointLimitCone(m_coneAngle, m_coneAngle));
     }
+    joint.setSphericalJointFlag(physx::PxSphericalJointFlag::eLIMIT_ENABLED, m_enableConeLimit);
 
-    // Configure break force if breakable
-    if (config.breakable)
-    {
-        joint->setBreakForce(config.breakForce, config.breakTorque);
-    }
-
-    joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, config.enableCollision);
-
-    return joint;
+    applyCommonSettings(joint, config);
 }
 
 JointDef BallSocketBondType::getJointDef(const Bond& bond, const BondConfig& config) const
@@ -402,23 +495,44 @@ physx::PxJoint* PrismaticBondType::createJoint(
     if (!joint)
         return nullptr;
 
+    configureJoint(*joint, config);
+
+    return joint;
+}
+
+bool PrismaticBondType::reconfigureJoint(
+    physx::PxJoint* joint,
+    physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+    physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+    const Bond& bond,
+    const BondConfig& config) const
+{
+    (void)bond;
+
+    physx::PxPrismaticJoint* prismaticJoint = joint ? joint->is<physx::PxPrismaticJoint>() : nullptr;
+    if (!prismaticJoint)
+        return false;
+
+    physx::PxQuat axisRot = computeAxisRotation();
+    rebindJoint(*prismaticJoint,
+        actor1, physx::PxTransform(frame1.p, frame1.q * axisRot),
+        actor2, physx::PxTransform(frame2.p, frame2.q * axisRot));
+    configureJoint(*prismaticJoint, config);
+
+    return true;
+}
+
+void PrismaticBondType::configureJoint(physx::PxPrismaticJoint& joint, const BondConfig& config) const
+{
     // Configure limits
     if (m_enableLimits)
     {
         physx::PxTolerancesScale scale;
-        joint->setLimit(physx::PxJointLinearLimitPair(scale, m_lowerLimit, m_upperLimit));
-        joint->setPrismaticJointFlag(physx::PxPrismaticJointFlag::eLIMIT_ENABLED, true);
+        joint.setLimit(physx::PxJointLinearLimitPair(scale, m_lowerLimit, m_upperLimit));
     }
+    joint.setPrismaticJointFlag(physx::PxPrismaticJointFlag::eLIMIT_ENABLED, m_enableLimits);
 
-    // Configure break force if breakable
-    if (config.breakable)
-    {
-        joint->setBreakForce(config.breakForce, config.breakTorque);
-    }
-
-    joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, config.enableCollision);
-
-    return joint;
+    applyCommonSettings(joint, config);
 }
 
 JointDef PrismaticBondType::getJointDef(const Bond& bond, const BondConfig& config) const
@@ -472,15 +586,41 @@ physx::PxJoint* D6BondType::createJoint(
     if (!joint)
         return nullptr;
 
+    configureJoint(*joint, config);
+
+    return joint;
+}
+
+bool D6BondType::reconfigureJoint(
+    physx::PxJoint* joint,
+    physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+    physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+    const Bond& bond,
+    const BondConfig& config) const
+{
+    (void)bond;
+
+    physx::PxD6Joint* d6Joint = joint ? joint->is<physx::PxD6Joint>() : nullptr;
+    if (!d6Joint)
+        return false;
+
+    rebindJoint(*d6Joint, actor1, frame1, actor2, frame2);
+    configureJoint(*d6Joint, config);
+
+    return true;
+}
+
+void D6BondType::configureJoint(physx::PxD6Joint& joint, const BondConfig& config) const
+{
     // Configure linear axes
-    joint->setMotion(physx::PxD6Axis::eX, m_linearX.motion);
-    joint->setMotion(physx::PxD6Axis::eY, m_linearY.motion);
-    joint->setMotion(physx::PxD6Axis::eZ, m_linearZ.motion);
+    joint.setMotion(physx::PxD6Axis::eX, m_linearX.motion);
+    joint.setMotion(physx::PxD6Axis::eY, m_linearY.motion);
+    joint.setMotion(physx::PxD6Axis::eZ, m_linearZ.motion);
 
     // Configure angular axes
-    joint->setMotion(physx::PxD6Axis::eTWIST, m_twist.motion);
-    joint->setMotion(physx::PxD6Axis::eSWING1, m_swing1.motion);
-    joint->setMotion(physx::PxD6Axis::eSWING2, m_swing2.motion);
+    joint.setMotion(physx::PxD6Axis::eTWIST, m_twist.motion);
+    joint.setMotion(physx::PxD6Axis::eSWING1, m_swing1.motion);
+    joint.setMotion(physx::PxD6Axis::eSWING2, m_swing2.motion);
 
     // Configure linear limits if needed
     if (m_linearX.motion == physx::PxD6Motion::eLIMITED ||
@@ -495,64 +635,44 @@ physx::PxJoint* D6BondType::createJoint(
         });
         (void)maxLimit; // Suppress unused variable warning
         physx::PxTolerancesScale scale;
-        joint->setLinearLimit(physx::PxD6Axis::eX, physx::PxJointLinearLimitPair(scale, m_linearX.limitLower, m_linearX.limitUpper));
-        joint->setLinearLimit(physx::PxD6Axis::eY, physx::PxJointLinearLimitPair(scale, m_linearY.limitLower, m_linearY.limitUpper));
-        joint->setLinearLimit(physx::PxD6Axis::eZ, physx::PxJointLinearLimitPair(scale, m_linearZ.limitLower, m_linearZ.limitUpper));
+        joint.setLinearLimit(physx::PxD6Axis::eX, physx::PxJointLinearLimitPair(scale, m_linearX.limitLower, m_linearX.limitUpper));
+        joint.setLinearLimit(physx::PxD6Axis::eY, physx::PxJointLinearLimitPair(scale, m_linearY.limitLower, m_linearY.limitUpper));
+        joint.setLinearLimit(physx::PxD6Axis::eZ, physx::PxJointLinearLimitPair(scale, m_linearZ.limitLower, m_linearZ.limitUpper));
     }
 
     // Configure angular limits
     if (m_twist.motion == physx::PxD6Motion::eLIMITED)
     {
-        joint->setTwistLimit(physx::PxJointAngularLimitPair(m_twist.limitLower, m_twist.limitUpper));
+        joint.setTwistLimit(physx::PxJointAngularLimitPair(m_twist.limitLower, m_twist.limitUpper));
     }
 
     if (m_swing1.motion == physx::PxD6Motion::eLIMITED ||
         m_swing2.motion == physx::PxD6Motion::eLIMITED)
     {
-        joint->setSwingLimit(physx::PxJointLimitCone(
+        joint.setSwingLimit(physx::PxJointLimitCone(
             (m_swing1.motion == physx::PxD6Motion::eLIMITED) ? m_swing1.limitUpper : physx::PxPi,
             (m_swing2.motion == physx::PxD6Motion::eLIMITED) ? m_swing2.limitUpper : physx::PxPi));
     }
 
-    // Configure drives
-    if (m_linearX.driveStiffness > 0 || m_linearX.driveDamping > 0)
-    {
-        joint->setDrive(physx::PxD6Drive::eX,
-            physx::PxD6JointDrive(m_linearX.driveStiffness, m_linearX.driveDamping, PX_MAX_F32));
-    }
-    if (m_linearY.driveStiffness > 0 || m_linearY.driveDamping > 0)
-    {
-        joint->setDrive(physx::PxD6Drive::eY,
-            physx::PxD6JointDrive(m_linearY.driveStiffness, m_linearY.driveDamping, PX_MAX_F32));
-    }
-    if (m_linearZ.driveStiffness > 0 || m_linearZ.driveDamping > 0)
+    // Configure drives; axes without one get a zero drive, which also clears
+    // a drive left on a pooled joint
+    auto makeDrive = [](float stiffness, float damping)
     {
-        joint->setDrive(physx::PxD6Drive::eZ,
-            physx::PxD6JointDrive(m_linearZ.driveStiffness, m_linearZ.driveDamping, PX_MAX_F32));
-    }
-    if (m_twist.driveStiffness > 0 || m_twist.driveDamping > 0)
-    {
-        joint->setDrive(physx::PxD6Drive::eTWIST,
-            physx::PxD6JointDrive(m_twist.driveStiffness, m_twist.driveDamping, PX_MAX_F32));
-    }
-    if (m_swing1.driveStiffness > 0 || m_swing1.driveDamping > 0 ||
-        m_swing2.driveStiffness > 0 || m_swing2.driveDamping > 0)
-    {
-        float swingStiff = std::max(m_swing1.driveStiffness, m_swing2.driveStiffness);
-        float swingDamp = std::max(m_swing1.driveDamping, m_swing2.driveDamping);
-        joint->setDrive(physx::PxD6Drive::eSWING,
-            physx::PxD6JointDrive(swingStiff, swingDamp, PX_MAX_F32));
-    }
+        return (stiffness > 0 || damping > 0)
+            ? physx::PxD6JointDrive(stiffness, damping, PX_MAX_F32)
+            : physx::PxD6JointDrive();
+    };
 
-    // Configure break force if breakable
-    if (config.breakable)
-    {
-        joint->setBreakForce(config.breakForce, config.breakTorque);
-    }
+    joint.setDrive(physx::PxD6Drive::eX, makeDrive(m_linearX.driveStiffness, m_linearX.driveDamping));
+    joint.setDrive(physx::PxD6Drive::eY, makeDrive(m_linearY.driveStiffness, m_linearY.driveDamping));
+    joint.setDrive(physx::PxD6Drive::eZ, makeDrive(m_linearZ.driveStiffness, m_linearZ.driveDamping));
+    joint.setDrive(physx::PxD6Drive::eTWIST, makeDrive(m_twist.driveStiffness, m_twist.driveDamping));
 
-    joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, config.enableCollision);
+    float swingStiff = std::max(m_swing1.driveStiffness, m_swing2.driveStiffness);
+    float swingDamp = std::max(m_swing1.driveDamping, m_swing2.driveDamping);
+    joint.setDrive(physx::PxD6Drive::eSWING, makeDrive(swingStiff, swingDamp));
 
-    return joint;
+    applyCommonSettings(joint, config);
 }
 
 JointDef D6BondType::getJointDef(const Bond& bond, const BondConfig& config) const
@@ -23,6 +23,13 @@ public:
         const Bond& bond,
         const BondConfig& config) const override;
 
+    bool reconfigureJoint(
+        physx::PxJoint* joint,
+        physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+        physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+        const Bond& bond,
+        const BondConfig& config) const override;
+
     JointDef getJointDef(const Bond& bond, const BondConfig& config) const override;
     std::unique_ptr<IBondType> clone() const override;
 };
@@ -48,6 +55,13 @@ public:
         const Bond& bond,
         const BondConfig& config) const override;
 
+    bool reconfigureJoint(
+        physx::PxJoint* joint,
+        physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+        physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+        const Bond& bond,
+        const BondConfig& config) const override;
+
     JointDef getJointDef(const Bond& bond, const BondConfig& config) const override;
     std::unique_ptr<IBondType> clone() const override;
 
@@ -57,6 +71,13 @@ public:
 private:
     float m_defaultStiffness;
     float m_defaultDamping;
+
+    // Apply distance limits, spring and common settings (shared by create and reuse)
+    void configureJoint(
+        physx::PxDistanceJoint& joint,
+        physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+        physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+        const BondConfig& config) const;
 };
 
 /// Hinged (revolute) bond type
@@ -84,6 +105,13 @@ public:
         const Bond& bond,
         const BondConfig& config) const override;
 
+    bool reconfigureJoint(
+        physx::PxJoint* joint,
+        physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+        physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+        const Bond& bond,
+        const BondConfig& config) const override;
+
     JointDef getJointDef(const Bond& bond, const BondConfig& config) const override;
     std::unique_ptr<IBondType> clone() const override;
 
@@ -95,6 +123,8 @@ private:
 
     // Helper to create rotation that aligns Z axis with desired axis
     physx::PxQuat computeAxisRotation() const;
+
+    void configureJoint(physx::PxRevoluteJoint& joint, const BondConfig& config) const;
 };
 
 /// Ball-socket (spherical) bond type
@@ -118,12 +148,21 @@ public:
         const Bond& bond,
         const BondConfig& config) const override;
 
+    bool reconfigureJoint(
+        physx::PxJoint* joint,
+        physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+        physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+        const Bond& bond,
+        const BondConfig& config) const override;
+
     JointDef getJointDef(const Bond& bond, const BondConfig& config) const override;
     std::unique_ptr<IBondType> clone() const override;
 
 private:
     bool m_enableConeLimit;
     float m_coneAngle;
+
+    void configureJoint(physx::PxSphericalJoint& joint, const BondConfig& config) const;
 };
 
 /// Prismatic (sliding) bond type
@@ -151,6 +190,13 @@ public:
         const Bond& bond,
         const BondConfig& config) const override;
 
+    bool reconfigureJoint(
+        physx::PxJoint* joint,
+        physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+        physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+        const Bond& bond,
+        const BondConfig& config) const override;
+
     JointDef getJointDef(const Bond& bond, const BondConfig& config) const override;
     std::unique_ptr<IBondType> clone() const override;
 
@@ -161,6 +207,7 @@ private:
     float m_upperLimit;
 
     physx::PxQuat computeAxisRotation() const;
+    void configureJoint(physx::PxPrismaticJoint& joint, const BondConfig& config) const;
 };
 
 /// D6 (fully configurable) bond type
@@ -189,6 +236,13 @@ public:
         const Bond& bond,
         const BondConfig& config) const override;
 
+    bool reconfigureJoint(
+        physx::PxJoint* joint,
+        physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+        physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+        const Bond& bond,
+        const BondConfig& config) const override;
+
     JointDef getJointDef(const Bond& bond, const BondConfig& config) const override;
     std::unique_ptr<IBondType> clone() const override;
 
@@ -203,6 +257,8 @@ public:
 private:
     AxisConfig m_linearX, m_linearY, m_linearZ;
     AxisConfig m_twist, m_swing1, m_swing2;
+
+    void configureJoint(physx::PxD6Joint& joint, const BondConfig& config) const;
 };
 
 } // namespace bonding
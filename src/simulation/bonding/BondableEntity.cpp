@@ -1,51 +1,86 @@
 #include "BondableEntity.h"
+#include "SiteTransformCache.h"
+#include <algorithm>
 
 namespace bonding
 {
 
-void BondableEntity::initialize(const BondableEntityDef& def, physx::PxRigidActor* actor)
+void BondableEntity::initialize(EntityTemplatePtr entityTemplate, uint64_t entityId, physx::PxRigidActor* actor)
 {
-    m_definition = def;
-    m_entityId = def.entityId;
-    m_entityType = def.entityType;
+    m_template = std::move(entityTemplate);
+    m_entityId = entityId;
     m_actor = actor;
-    m_properties = def.properties;
+    m_properties.reset();
+
+    m_siteBonds.assign(m_template->getBondSlotCount(), 0);
+
+    clearAllBonds();
+}
+
+void BondableEntity::initialize(const BondableEntityDef& def, physx::PxRigidActor* actor)
+{
+    initialize(def, def.entityId, actor);
+}
 
-    // Initialize site bond tracking
-    m_siteBonds.clear();
-    for (const auto& site : m_definition.bondingSites)
+void BondableEntity::initialize(const BondableEntityDef& def, uint64_t entityId, physx::PxRigidActor* actor)
+{
+    initialize(std::make_shared<const EntityTemplate>(def), entityId, actor);
+}
+
+PropertyMap& BondableEntity::getProperties()
+{
+    if (!m_properties)
     {
-        m_siteBonds[site.siteId] = std::unordered_set<uint64_t>();
+        m_properties = std::make_unique<PropertyMap>(m_template->getProperties());
     }
+    return *m_properties;
 }
 
 physx::PxVec3 BondableEntity::getSiteWorldPosition(uint32_t siteId) const
 {
-    const BondingSiteDef* site = getSiteDef(siteId);
-    if (!site || !m_actor)
+    if (m_transformCache && m_transformCache->isActive())
+    {
+        int32_t index = getSiteIndex(siteId);
+        if (index < 0)
+            return physx::PxVec3(0.0f);
+
+        return m_transformCache->getPosition(m_transformCache->getFirstSiteIndex(m_transformRecord) + index);
+    }
+
+    int32_t index = getSiteIndex(siteId);
+    if (index < 0 || !m_actor)
         return physx::PxVec3(0.0f);
 
     physx::PxTransform worldTransform = m_actor->getGlobalPose();
-    physx::PxVec3 localPos = site->getLocalPosition();
-
-    return worldTransform.transform(localPos);
+    return worldTransform.transform(getSiteLocalPosition(index));
 }
 
 physx::PxVec3 BondableEntity::getSiteWorldDirection(uint32_t siteId) const
 {
-    const BondingSiteDef* site = getSiteDef(siteId);
-    if (!site || !m_actor)
+    if (m_transformCache && m_transformCache->isActive())
+    {
+        int32_t index = getSiteIndex(siteId);
+        if (index < 0)
+            return physx::PxVec3(1.0f, 0.0f, 0.0f);
+
+        return m_transformCache->getDirection(m_transformCache->getFirstSiteIndex(m_transformRecord) + index);
+    }
+
+    int32_t index = getSiteIndex(siteId);
+    if (index < 0 || !m_actor)
         return physx::PxVec3(1.0f, 0.0f, 0.0f);
 
     physx::PxTransform worldTransform = m_actor->getGlobalPose();
-    physx::PxVec3 localDir = site->getLocalDirection();
 
     // Rotate direction without translation
-    return worldTransform.q.rotate(localDir);
+    return worldTransform.q.rotate(getSiteLocalDirection(index));
 }
 
 physx::PxTransform BondableEntity::getWorldTransform() const
 {
+    if (m_transformCache && m_transformCache->isActive())
+        return m_transformCache->getPose(m_transformRecord);
+
     if (!m_actor)
         return physx::PxTransform(physx::PxIdentity);
 
@@ -56,7 +91,7 @@ std::vector<uint32_t> BondableEntity::getAvailableSites() const
 {
     std::vector<uint32_t> available;
 
-    for (const auto& site : m_definition.bondingSites)
+    for (const auto& site : m_template->getSites())
     {
         if (canBondAt(site.siteId))
         {
@@ -69,113 +104,206 @@ std::vector<uint32_t> BondableEntity::getAvailableSites() const
 
 bool BondableEntity::canBondAt(uint32_t siteId) const
 {
-    const BondingSiteDef* site = getSiteDef(siteId);
-    if (!site)
+    int32_t index = getSiteIndex(siteId);
+    if (index < 0)
         return false;
 
-    uint32_t currentBonds = getBondCountAt(siteId);
-    return currentBonds < site->maxValency;
+    return m_siteBondCounts[index] < m_template->getSites()[index].maxValency;
 }
 
 uint32_t BondableEntity::getBondCountAt(uint32_t siteId) const
 {
-    auto it = m_siteBonds.find(siteId);
-    if (it == m_siteBonds.end())
+    int32_t index = getSiteIndex(siteId);
+    if (index < 0)
         return 0;
 
-    return static_cast<uint32_t>(it->second.size());
+    return m_siteBondCounts[index];
 }
 
 uint32_t BondableEntity::getMaxValencyAt(uint32_t siteId) const
 {
-    const BondingSiteDef* site = getSiteDef(siteId);
-    if (!site)
+    int32_t index = getSiteIndex(siteId);
+    if (index < 0)
         return 0;
 
-    return site->maxValency;
+    return m_template->getSites()[index].maxValency;
 }
 
 std::vector<uint64_t> BondableEntity::getBondsAt(uint32_t siteId) const
 {
-    auto it = m_siteBonds.find(siteId);
-    if (it == m_siteBonds.end())
+    int32_t index = getSiteIndex(siteId);
+    if (index < 0)
         return {};
 
-    return std::vector<uint64_t>(it->second.begin(), it->second.end());
+    auto first = m_siteBonds.begin() + m_template->getSiteBondOffset(index);
+    return std::vector<uint64_t>(first, first + m_siteBondCounts[index]);
 }
 
 std::vector<uint64_t> BondableEntity::getAllBondIds() const
 {
-    std::unordered_set<uint64_t> allBonds;
+    std::vector<uint64_t> allBonds;
+    allBonds.reserve(m_distinctBondCount);
 
-    for (const auto& [siteId, bonds] : m_siteBonds)
+    for (size_t i = 0; i < m_siteBondCounts.size(); ++i)
     {
-        allBonds.insert(bonds.begin(), bonds.end());
+        auto first = m_siteBonds.begin() + m_template->getSiteBondOffset(i);
+        allBonds.insert(allBonds.end(), first, first + m_siteBondCounts[i]);
     }
 
-    return std::vector<uint64_t>(allBonds.begin(), allBonds.end());
+    // A bond between two sites of this entity appears twice
+    if (allBonds.size() != m_distinctBondCount)
+    {
+        std::sort(allBonds.begin(), allBonds.end());
+        allBonds.erase(std::unique(allBonds.begin(), allBonds.end()), allBonds.end());
+    }
+
+    return allBonds;
 }
 
-size_t BondableEntity::getTotalBondCount() const
+bool BondableEntity::recordBond(uint32_t siteId, uint64_t bondId)
 {
-    std::unordered_set<uint64_t> allBonds;
+    int32_t index = getSiteIndex(siteId);
+    if (index < 0)
+        return false;
 
-    for (const auto& [siteId, bonds] : m_siteBonds)
+    uint64_t* bonds = m_siteBonds.data() + m_template->getSiteBondOffset(index);
+    uint32_t& count = m_siteBondCounts[index];
+    const uint32_t maxValency = m_template->getSites()[index].maxValency;
+
+    for (uint32_t i = 0; i < count; ++i)
     {
-        allBonds.insert(bonds.begin(), bonds.end());
+        if (bonds[i] == bondId)
+            return true; // Already recorded
     }
 
-    return allBonds.size();
-}
+    if (count >= maxValency)
+        return false;
 
-bool BondableEntity::isFullySaturated() const
-{
-    for (const auto& site : m_definition.bondingSites)
+    if (countBondOccurrences(bondId) == 0)
+        m_distinctBondCount++;
+
+    bonds[count++] = bondId;
+    if (count == maxValency)
+        m_availableSiteCount--;
+
+    if (count == 1)
     {
-        if (canBondAt(site.siteId))
-            return false;
+        const uint32_t siteIndex = static_cast<uint32_t>(index);
+        m_bondedSites.insert(
+            std::lower_bound(m_bondedSites.begin(), m_bondedSites.end(), siteIndex), siteIndex);
     }
+    updateBondPlane();
+
     return true;
 }
 
-void BondableEntity::recordBond(uint32_t siteId, uint64_t bondId)
+void BondableEntity::removeBond(uint32_t siteId, uint64_t bondId)
 {
-    auto it = m_siteBonds.find(siteId);
-    if (it == m_siteBonds.end())
+    int32_t index = getSiteIndex(siteId);
+    if (index < 0)
+        return;
+
+    uint64_t* bonds = m_siteBonds.data() + m_template->getSiteBondOffset(index);
+    uint32_t& count = m_siteBondCounts[index];
+    const uint32_t maxValency = m_template->getSites()[index].maxValency;
+
+    for (uint32_t i = 0; i < count; ++i)
     {
-        // Site doesn't exist, create it
-        m_siteBonds[siteId] = std::unordered_set<uint64_t>();
-        it = m_siteBonds.find(siteId);
+        if (bonds[i] != bondId)
+            continue;
+
+        // Keep insertion order of the remaining bonds
+        std::copy(bonds + i + 1, bonds + count, bonds + i);
+        if (count == maxValency)
+            m_availableSiteCount++;
+        count--;
+
+        if (countBondOccurrences(bondId) == 0)
+            m_distinctBondCount--;
+
+        if (count == 0)
+        {
+            m_bondedSites.erase(std::lower_bound(
+                m_bondedSites.begin(), m_bondedSites.end(), static_cast<uint32_t>(index)));
+        }
+        updateBondPlane();
+        return;
     }
+}
 
-    it->second.insert(bondId);
+void BondableEntity::clearAllBonds()
+{
+    m_siteBondCounts.assign(m_template->getSiteCount(), 0);
+    m_distinctBondCount = 0;
+    m_availableSiteCount = m_template->getBondableSiteCount();
+
+    m_bondedSites.clear();
+    updateBondPlane();
 }
 
-void BondableEntity::removeBond(uint32_t siteId, uint64_t bondId)
+void BondableEntity::updateBondPlane()
 {
-    auto it = m_siteBonds.find(siteId);
-    if (it != m_siteBonds.end())
+    m_localBondPlane = physx::PxVec3(0.0f);
+    m_hasBondPlane = false;
+
+    if (m_distinctBondCount < 2)
+        return;
+
+    // Direction of each bond slot in site order; the first two define the plane
+    physx::PxVec3 firstDirection(0.0f);
+    bool haveFirst = false;
+    for (uint32_t index : m_bondedSites)
     {
-        it->second.erase(bondId);
+        physx::PxVec3 direction = getSiteLocalPosition(index).getNormalized();
+        if (direction.magnitude() <= 0.001f)
+            continue;
+
+        for (uint32_t i = 0; i < m_siteBondCounts[index]; ++i)
+        {
+            if (!haveFirst)
+            {
+                firstDirection = direction;
+                haveFirst = true;
+                continue;
+            }
+
+            m_localBondPlane = firstDirection.cross(direction).getNormalized();
+            m_hasBondPlane = m_localBondPlane.magnitude() > 0.001f;
+            return;
+        }
     }
 }
 
-void BondableEntity::clearAllBonds()
+uint32_t BondableEntity::countBondOccurrences(uint64_t bondId) const
 {
-    for (auto& [siteId, bonds] : m_siteBonds)
+    uint32_t occurrences = 0;
+    for (size_t i = 0; i < m_siteBondCounts.size(); ++i)
     {
-        bonds.clear();
+        const uint64_t* bonds = m_siteBonds.data() + m_template->getSiteBondOffset(i);
+        for (uint32_t j = 0; j < m_siteBondCounts[i]; ++j)
+        {
+            if (bonds[j] == bondId)
+                occurrences++;
+        }
     }
+    return occurrences;
 }
 
 const BondingSiteDef* BondableEntity::getSiteDef(uint32_t siteId) const
 {
-    return m_definition.findSite(siteId);
+    int32_t index = getSiteIndex(siteId);
+    return (index >= 0) ? &m_template->getSites()[index] : nullptr;
 }
 
 const std::vector<BondingSiteDef>& BondableEntity::getAllSites() const
 {
-    return m_definition.bondingSites;
+    return m_template->getSites();
+}
+
+void BondableEntity::bindTransformCache(const SiteTransformCache* cache, uint32_t record)
+{
+    m_transformCache = cache;
+    m_transformRecord = record;
 }
 
 } // namespace bonding
@@ -2,40 +2,85 @@
 
 #include "BondableEntityDef.h"
 #include "Bond.h"
+#include "EntityTemplate.h"
 #include <PxPhysicsAPI.h>
-#include <unordered_map>
-#include <unordered_set>
+#include <memory>
 #include <vector>
 #include <cstdint>
 
 namespace bonding
 {
 
+class SiteTransformCache;
+
 /// Runtime representation of a bondable entity
-/// Tracks the entity's current bonding state and provides world-space queries
+/// Tracks the entity's current bonding state and provides world-space queries.
+/// The definition and site tables live in a shared EntityTemplate; the entity
+/// itself holds only its bond records and, once modified, its own properties.
 class BondableEntity
 {
 public:
     BondableEntity() = default;
 
-    /// Initialize from definition
+    /// Initialize from a shared template
+    void initialize(EntityTemplatePtr entityTemplate, uint64_t entityId, physx::PxRigidActor* actor);
+
+    /// Initialize from definition (builds a template of its own)
     void initialize(const BondableEntityDef& def, physx::PxRigidActor* actor);
 
+    /// Initialize from definition with an assigned ID (def.entityId is ignored)
+    void initialize(const BondableEntityDef& def, uint64_t entityId, physx::PxRigidActor* actor);
+
     /// Get the entity's unique ID
     uint64_t getEntityId() const { return m_entityId; }
 
     /// Get the entity type
-    const std::string& getEntityType() const { return m_entityType; }
+    const std::string& getEntityType() const { return m_template->getEntityType(); }
 
     /// Get the PhysX actor
     physx::PxRigidActor* getActor() const { return m_actor; }
 
+    /// Get the template this entity was built from
+    const EntityTemplatePtr& getTemplate() const { return m_template; }
+
     /// Get the underlying definition
-    const BondableEntityDef& getDefinition() const { return m_definition; }
+    /// Shared with other entities of the template: its entityId and actor pose
+    /// are not this entity's (use getEntityId() and getWorldTransform()).
+    const BondableEntityDef& getDefinition() const { return m_template->getDefinition(); }
 
     /// Get properties
-    PropertyMap& getProperties() { return m_properties; }
-    const PropertyMap& getProperties() const { return m_properties; }
+    /// The mutable overload gives the entity its own copy of the template's
+    /// properties on first use.
+    PropertyMap& getProperties();
+    const PropertyMap& getProperties() const
+    {
+        return m_properties ? *m_properties : m_template->getProperties();
+    }
+
+    /// Get a declared entity property
+    /// Reads the template's typed columns; falls back to a lookup by name when
+    /// the entity has its own properties, or the key is from another schema or
+    /// was declared after the template was built.
+    template<typename T>
+    std::optional<T> getProperty(const PropertyKey<T>& key) const
+    {
+        const PropertyBlock& block = m_template->getPropertyBlock();
+        if (!m_properties && block.covers(key))
+            return block.get(0, key);
+
+        return getProperties().get<T>(key.name);
+    }
+
+    /// Get a declared property of a site by dense index
+    template<typename T>
+    std::optional<T> getSiteProperty(size_t index, const PropertyKey<T>& key) const
+    {
+        const PropertyBlock& block = m_template->getSitePropertyBlock();
+        if (block.covers(key))
+            return block.get(index, key);
+
+        return m_template->getSites()[index].properties.get<T>(key.name);
+    }
 
     // --- World-space queries ---
 
@@ -53,6 +98,9 @@ public:
     /// Get all available (non-saturated) site IDs
     std::vector<uint32_t> getAvailableSites() const;
 
+    /// Get the number of available (non-saturated) sites
+    size_t getAvailableSiteCount() const { return m_availableSiteCount; }
+
     /// Check if a specific site can accept another bond
     bool canBondAt(uint32_t siteId) const;
 
@@ -69,15 +117,32 @@ public:
     std::vector<uint64_t> getAllBondIds() const;
 
     /// Get total number of bonds across all sites
-    size_t getTotalBondCount() const;
+    size_t getTotalBondCount() const { return m_distinctBondCount; }
 
     /// Check if entity is fully saturated (all sites at max valency)
-    bool isFullySaturated() const;
+    bool isFullySaturated() const { return m_availableSiteCount == 0; }
+
+    // --- Bond geometry (local frame, kept up to date as bonds change) ---
+
+    /// Dense indices of the sites holding at least one bond, in site order
+    const std::vector<uint32_t>& getBondedSiteIndices() const { return m_bondedSites; }
+
+    /// Get the plane of the entity's bonds in its local frame
+    /// The plane is spanned by the directions from the entity origin to the
+    /// sites of its first two bonds (a site holding several bonds counts once
+    /// per bond).
+    /// @return False if there are fewer than two bonds or they span no plane
+    bool getLocalBondPlane(physx::PxVec3& normal) const
+    {
+        normal = m_localBondPlane;
+        return m_hasBondPlane;
+    }
 
     // --- Bonding operations (called by DynamicBondManager) ---
 
     /// Record that a bond was formed at a site
-    void recordBond(uint32_t siteId, uint64_t bondId);
+    /// @return False if the site does not exist or is already at max valency
+    bool recordBond(uint32_t siteId, uint64_t bondId);
 
     /// Remove a bond record from a site
     void removeBond(uint32_t siteId, uint64_t bondId);
@@ -94,17 +159,63 @@ public:
     const std::vector<BondingSiteDef>& getAllSites() const;
 
     /// Get number of bonding sites
-    size_t getSiteCount() const { return m_definition.bondingSites.size(); }
+    size_t getSiteCount() const { return m_template->getSiteCount(); }
+
+    /// Get the dense index of a site (its position in getAllSites()), or -1
+    int32_t getSiteIndex(uint32_t siteId) const { return m_template->getSiteIndex(siteId); }
+
+    /// Get a site's local position by dense index
+    const physx::PxVec3& getSiteLocalPosition(size_t index) const { return m_template->getSiteLocalPosition(index); }
+
+    /// Get a site's local direction by dense index
+    const physx::PxVec3& getSiteLocalDirection(size_t index) const { return m_template->getSiteLocalDirection(index); }
+
+    /// Get a site's type compatibility masks by dense index
+    const SiteTypeMask& getSiteTypeMask(size_t index) const { return m_template->getSiteTypeMask(index); }
+
+    // --- Transform cache (managed by SiteTransformCache) ---
+
+    /// Bind to a record of a site transform cache (nullptr to unbind)
+    void bindTransformCache(const SiteTransformCache* cache, uint32_t record);
+
+    /// Get the bound transform cache, if any
+    const SiteTransformCache* getTransformCache() const { return m_transformCache; }
+
+    /// Get the record index in the bound transform cache
+    uint32_t getTransformRecord() const { return m_transformRecord; }
 
 private:
     uint64_t m_entityId = 0;
-    std::string m_entityType;
     physx::PxRigidActor* m_actor = nullptr;
-    BondableEntityDef m_definition;
-    PropertyMap m_properties;
+    EntityTemplatePtr m_template;
+
+    /// Own properties; null while the template's are used unmodified
+    std::unique_ptr<PropertyMap> m_properties;
+
+    /// Bond IDs of all sites in one array; site i owns the template's slots
+    /// [getSiteBondOffset(i), getSiteBondOffset(i) + maxValency) and uses the
+    /// first m_siteBondCounts[i] entries
+    std::vector<uint64_t> m_siteBonds;
+    std::vector<uint32_t> m_siteBondCounts;
+
+    /// Cached counters
+    size_t m_availableSiteCount = 0;
+    size_t m_distinctBondCount = 0;
+
+    /// Bonded site indices and bond plane; only change with the bonds
+    std::vector<uint32_t> m_bondedSites;
+    physx::PxVec3 m_localBondPlane{0.0f};
+    bool m_hasBondPlane = false;
+
+    /// Number of sites of this entity holding a bond
+    uint32_t countBondOccurrences(uint64_t bondId) const;
+
+    /// Recompute the bond plane after a change to the bonds
+    void updateBondPlane();
 
-    /// Map from site ID to set of bond IDs at that site
-    std::unordered_map<uint32_t, std::unordered_set<uint64_t>> m_siteBonds;
+    /// Cached world transforms; used while the cache is active
+    const SiteTransformCache* m_transformCache = nullptr;
+    uint32_t m_transformRecord = 0;
 };
 
 } // namespace bonding
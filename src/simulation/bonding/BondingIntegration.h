@@ -5,6 +5,7 @@
 
 // Core components
 #include "PropertyMap.h"
+#include "PropertySchema.h"
 #include "BondingSiteDef.h"
 #include "BondableEntityDef.h"
 #include "BondableEntity.h"
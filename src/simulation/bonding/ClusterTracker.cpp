@@ -0,0 +1,290 @@
+#include "ClusterTracker.h"
+#include <utility>
+
+namespace bonding
+{
+
+// =============================================================================
+// Updates
+// =============================================================================
+
+void ClusterTracker::clear()
+{
+    m_parent.clear();
+    m_size.clear();
+    m_members.clear();
+    m_stale.clear();
+    m_entityIds.clear();
+    m_nodeIndex.clear();
+    m_freeNodes.clear();
+    m_staleRoots.clear();
+    m_histogram.clear();
+    m_clusterCount = 0;
+}
+
+void ClusterTracker::clearEdges()
+{
+    for (const auto& [entityId, node] : m_nodeIndex)
+    {
+        resetNode(node);
+    }
+
+    m_staleRoots.clear();
+    m_histogram.clear();
+    m_clusterCount = m_nodeIndex.size();
+    if (m_clusterCount > 0)
+    {
+        m_histogram[1] = static_cast<uint32_t>(m_clusterCount);
+    }
+}
+
+void ClusterTracker::reserve(size_t nodeCount)
+{
+    m_parent.reserve(nodeCount);
+    m_size.reserve(nodeCount);
+    m_members.reserve(nodeCount);
+    m_stale.reserve(nodeCount);
+    m_entityIds.reserve(nodeCount);
+    m_nodeIndex.reserve(nodeCount);
+}
+
+void ClusterTracker::addNode(uint64_t entityId)
+{
+    if (m_nodeIndex.count(entityId))
+        return;
+
+    uint32_t node;
+    if (!m_freeNodes.empty())
+    {
+        node = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    }
+    else
+    {
+        node = static_cast<uint32_t>(m_parent.size());
+        m_parent.push_back(node);
+        m_size.push_back(1);
+        m_members.emplace_back();
+        m_stale.push_back(0);
+        m_entityIds.push_back(0);
+    }
+
+    m_entityIds[node] = entityId;
+    m_nodeIndex[entityId] = node;
+    resetNode(node);
+
+    addToHistogram(1);
+    m_clusterCount++;
+}
+
+void ClusterTracker::removeNode(uint64_t entityId)
+{
+    uint32_t node = nodeOf(entityId);
+    if (node == kNoNode)
+        return;
+
+    // The entity's bonds are gone from the graph; splitting leaves it alone
+    uint32_t root = findRoot(node);
+    if (m_size[root] > 1 && !m_stale[root])
+    {
+        m_stale[root] = 1;
+        m_staleRoots.push_back(root);
+    }
+    resolveStale();
+
+    removeFromHistogram(1);
+    m_clusterCount--;
+
+    m_members[node].clear();
+    m_nodeIndex.erase(entityId);
+    m_freeNodes.push_back(node);
+}
+
+void ClusterTracker::addEdge(const Bond& bond)
+{
+    uint32_t a = nodeOf(bond.endpoint1.entityId);
+    uint32_t b = nodeOf(bond.endpoint2.entityId);
+    if (a == kNoNode || b == kNoNode)
+        return;
+
+    unite(a, b);
+}
+
+void ClusterTracker::removeEdge(const Bond& bond)
+{
+    if (bond.endpoint1.entityId == bond.endpoint2.entityId)
+        return;
+
+    uint32_t node = nodeOf(bond.endpoint1.entityId);
+    if (node == kNoNode)
+        return;
+
+    uint32_t root = findRoot(node);
+    if (!m_stale[root])
+    {
+        m_stale[root] = 1;
+        m_staleRoots.push_back(root);
+    }
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+size_t ClusterTracker::getClusterCount() const
+{
+    resolveStale();
+    return m_clusterCount;
+}
+
+uint32_t ClusterTracker::getLargestClusterSize() const
+{
+    resolveStale();
+    return m_histogram.empty() ? 0 : m_histogram.rbegin()->first;
+}
+
+const ClusterTracker::SizeHistogram& ClusterTracker::getSizeHistogram() const
+{
+    resolveStale();
+    return m_histogram;
+}
+
+uint32_t ClusterTracker::getClusterSize(uint64_t entityId) const
+{
+    uint32_t node = nodeOf(entityId);
+    if (node == kNoNode)
+        return 0;
+
+    resolveStale();
+    return m_size[findRoot(node)];
+}
+
+bool ClusterTracker::areConnected(uint64_t entity1Id, uint64_t entity2Id) const
+{
+    uint32_t a = nodeOf(entity1Id);
+    uint32_t b = nodeOf(entity2Id);
+    if (a == kNoNode || b == kNoNode)
+        return false;
+
+    resolveStale();
+    return findRoot(a) == findRoot(b);
+}
+
+// =============================================================================
+// Internal
+// =============================================================================
+
+uint32_t ClusterTracker::nodeOf(uint64_t entityId) const
+{
+    auto it = m_nodeIndex.find(entityId);
+    return (it != m_nodeIndex.end()) ? it->second : kNoNode;
+}
+
+uint32_t ClusterTracker::findRoot(uint32_t node) const
+{
+    while (m_parent[node] != node)
+    {
+        m_parent[node] = m_parent[m_parent[node]];
+        node = m_parent[node];
+    }
+    return node;
+}
+
+void ClusterTracker::unite(uint32_t a, uint32_t b) const
+{
+    uint32_t rootA = findRoot(a);
+    uint32_t rootB = findRoot(b);
+    if (rootA == rootB)
+        return;
+
+    // Union by size; the smaller member list is appended to the larger
+    if (m_size[rootA] < m_size[rootB])
+        std::swap(rootA, rootB);
+
+    removeFromHistogram(m_size[rootA]);
+    removeFromHistogram(m_size[rootB]);
+    m_clusterCount--;
+
+    m_parent[rootB] = rootA;
+    m_size[rootA] += m_size[rootB];
+    addToHistogram(m_size[rootA]);
+
+    auto& members = m_members[rootA];
+    members.insert(members.end(), m_members[rootB].begin(), m_members[rootB].end());
+    m_members[rootB].clear();
+
+    // A stale cluster merged into another makes the union stale
+    if (m_stale[rootB])
+    {
+        m_stale[rootB] = 0;
+        if (!m_stale[rootA])
+        {
+            m_stale[rootA] = 1;
+            m_staleRoots.push_back(rootA);
+        }
+    }
+}
+
+void ClusterTracker::resetNode(uint32_t node) const
+{
+    m_parent[node] = node;
+    m_size[node] = 1;
+    m_members[node].assign(1, node);
+    m_stale[node] = 0;
+}
+
+void ClusterTracker::resolveStale() const
+{
+    if (m_staleRoots.empty())
+        return;
+
+    std::vector<uint32_t> staleRoots;
+    staleRoots.swap(m_staleRoots);
+
+    for (uint32_t root : staleRoots)
+    {
+        // Skip duplicates and roots already resolved
+        if (m_parent[root] != root || !m_stale[root])
+            continue;
+
+        std::vector<uint32_t> members = std::move(m_members[root]);
+        removeFromHistogram(m_size[root]);
+        m_clusterCount--;
+
+        for (uint32_t member : members)
+        {
+            resetNode(member);
+            addToHistogram(1);
+            m_clusterCount++;
+        }
+
+        // Bonds never leave the old cluster, so the re-union stays inside it
+        for (uint32_t member : members)
+        {
+            for (const BondEdge& edge : m_graph.getEdges(m_entityIds[member]))
+            {
+                uint32_t neighbor = nodeOf(edge.neighborId);
+                if (neighbor != kNoNode)
+                {
+                    unite(member, neighbor);
+                }
+            }
+        }
+    }
+}
+
+void ClusterTracker::addToHistogram(uint32_t size) const
+{
+    m_histogram[size]++;
+}
+
+void ClusterTracker::removeFromHistogram(uint32_t size) const
+{
+    auto it = m_histogram.find(size);
+    if (it != m_histogram.end() && --it->second == 0)
+    {
+        m_histogram.erase(it);
+    }
+}
+
+} // namespace bonding
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "BondGraph.h"
+#include <unordered_map>
+#include <map>
+#include <vector>
+#include <cstdint>
+
+namespace bonding
+{
+
+/// Connected components of the bond graph, maintained incrementally
+/// Bond formation is a union-find merge. A broken bond only marks its
+/// component stale; stale components are split again from the bond graph the
+/// next time the tracker is queried, so a burst of breaks in one cluster costs
+/// a single rebuild of that cluster and nothing else is touched.
+///
+/// The size histogram, cluster count and largest cluster are kept current
+/// with every merge and split, so queries do no traversal.
+class ClusterTracker
+{
+public:
+    /// Cluster size -> number of clusters of that size
+    using SizeHistogram = std::map<uint32_t, uint32_t>;
+
+    /// @param graph Bond graph used to split components after a break
+    explicit ClusterTracker(const BondGraph& graph) : m_graph(graph) {}
+
+    // Disable copy (holds a reference to the graph)
+    ClusterTracker(const ClusterTracker&) = delete;
+    ClusterTracker& operator=(const ClusterTracker&) = delete;
+
+    /// Remove all entities
+    void clear();
+
+    /// Make every entity its own cluster again
+    void clearEdges();
+
+    /// Reserve storage for a number of entities
+    void reserve(size_t nodeCount);
+
+    /// Add an entity as a singleton cluster
+    void addNode(uint64_t entityId);
+
+    /// Remove an entity; its bonds must already be gone from the graph
+    void removeNode(uint64_t entityId);
+
+    /// Merge the clusters of a newly formed bond
+    void addEdge(const Bond& bond);
+
+    /// Mark the cluster of a broken bond for re-splitting
+    void removeEdge(const Bond& bond);
+
+    // --- Queries (resolve pending breaks first) ---
+
+    /// Number of clusters, isolated entities included
+    size_t getClusterCount() const;
+
+    /// Size of the largest cluster (0 with no entities)
+    uint32_t getLargestClusterSize() const;
+
+    /// Number of clusters of each size
+    const SizeHistogram& getSizeHistogram() const;
+
+    /// Size of the cluster containing an entity (0 if unknown)
+    uint32_t getClusterSize(uint64_t entityId) const;
+
+    /// Check whether two entities are in the same cluster
+    bool areConnected(uint64_t entity1Id, uint64_t entity2Id) const;
+
+private:
+    static constexpr uint32_t kNoNode = 0xFFFFFFFFu;
+
+    const BondGraph& m_graph;
+
+    // Dense node storage; size and members are valid at roots only.
+    // Mutable so that const queries can apply pending splits and compress paths.
+    mutable std::vector<uint32_t> m_parent;
+    mutable std::vector<uint32_t> m_size;
+    mutable std::vector<std::vector<uint32_t>> m_members;
+    mutable std::vector<uint8_t> m_stale;
+    std::vector<uint64_t> m_entityIds;
+    std::unordered_map<uint64_t, uint32_t> m_nodeIndex;
+    std::vector<uint32_t> m_freeNodes;
+
+    mutable std::vector<uint32_t> m_staleRoots;
+    mutable SizeHistogram m_histogram;
+    mutable size_t m_clusterCount = 0;
+
+    /// Dense index of an entity, or kNoNode
+    uint32_t nodeOf(uint64_t entityId) const;
+
+    /// Root of a node's cluster (path halving)
+    uint32_t findRoot(uint32_t node) const;
+
+    /// Merge the clusters of two nodes; the merged root inherits staleness
+    void unite(uint32_t a, uint32_t b) const;
+
+    /// Make a node a singleton cluster
+    void resetNode(uint32_t node) const;
+
+    /// Split every stale cluster into its true components
+    void resolveStale() const;
+
+    void addToHistogram(uint32_t size) const;
+    void removeFromHistogram(uint32_t size) const;
+};
+
+} // namespace bonding
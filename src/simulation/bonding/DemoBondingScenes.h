@@ -50,31 +50,33 @@ inline void createDynamicBondingScene(
     // Create bondable particles (dimers)
     const int numParticles = 20;
 
-    for (int i = 0; i < numParticles; ++i)
-    {
-        // Create entity definition
-        BondableEntityDef def = BondableEntityDef::createDimer(0.5f);
-        def.entityType = "monomer";
+    // One shared template for all particles
+    BondableEntityDef def = BondableEntityDef::createDimer(0.5f);
+    def.entityType = "monomer";
 
-        // Random position
-        def.actorDef.posX = posDist(rng);
-        def.actorDef.posY = 5.0f + posDist(rng) * 0.3f;
-        def.actorDef.posZ = posDist(rng);
+    // Physics properties
+    def.actorDef.density = 1.0f;
+    def.actorDef.staticFriction = material->getStaticFriction();
+    def.actorDef.dynamicFriction = material->getDynamicFriction();
+    def.actorDef.restitution = material->getRestitution();
 
-        // Random velocity
-        def.actorDef.velX = velDist(rng);
-        def.actorDef.velY = 0.0f;
-        def.actorDef.velZ = velDist(rng);
+    EntityTemplatePtr monomer = bondManager.registerEntityTemplate(def);
 
-        // Physics properties
-        def.actorDef.density = 1.0f;
-        def.actorDef.staticFriction = material->getStaticFriction();
-        def.actorDef.dynamicFriction = material->getDynamicFriction();
-        def.actorDef.restitution = material->getRestitution();
+    std::vector<EntityPlacement> placements(numParticles);
+    for (auto& placement : placements)
+    {
+        // Random position
+        placement.pose.p.x = posDist(rng);
+        placement.pose.p.y = 5.0f + posDist(rng) * 0.3f;
+        placement.pose.p.z = posDist(rng);
 
-        bondManager.registerEntity(def);
+        // Random velocity
+        placement.linearVelocity.x = velDist(rng);
+        placement.linearVelocity.z = velDist(rng);
     }
 
+    bondManager.registerEntities(monomer, placements);
+
     // Add callback to log bond formation
     bondManager.onBondFormed([](const BondFormedEvent& event) {
         std::cout << "Bond formed: " << event.bond.bondId
@@ -128,31 +130,30 @@ inline void createRingFormationScene(
     // Create monomers that can form rings
     const int numMonomers = targetRingSize * 3; // 3x the ring size
 
-    for (int i = 0; i < numMonomers; ++i)
-    {
-        BondableEntityDef def = BondableEntityDef::createDimer(0.4f);
-        def.entityType = "ring_monomer";
+    BondableEntityDef def = BondableEntityDef::createDimer(0.4f);
+    def.entityType = "ring_monomer";
+    def.actorDef.density = 1.0f;
+    def.actorDef.staticFriction = 0.5f;
+    def.actorDef.dynamicFriction = 0.5f;
+    def.actorDef.restitution = 0.3f;
+
+    EntityTemplatePtr monomer = bondManager.registerEntityTemplate(def);
 
+    std::vector<EntityPlacement> placements(numMonomers);
+    for (auto& placement : placements)
+    {
         // Arrange in a plane
-        def.actorDef.posX = posDist(rng);
-        def.actorDef.posY = 5.0f;
-        def.actorDef.posZ = posDist(rng);
+        placement.pose.p.x = posDist(rng);
+        placement.pose.p.y = 5.0f;
+        placement.pose.p.z = posDist(rng);
 
         // Small random rotation
         float angle = static_cast<float>(rng()) / static_cast<float>(rng.max()) * physx::PxTwoPi;
-        def.actorDef.quatW = std::cos(angle / 2.0f);
-        def.actorDef.quatX = 0.0f;
-        def.actorDef.quatY = std::sin(angle / 2.0f);
-        def.actorDef.quatZ = 0.0f;
-
-        def.actorDef.density = 1.0f;
-        def.actorDef.staticFriction = 0.5f;
-        def.actorDef.dynamicFriction = 0.5f;
-        def.actorDef.restitution = 0.3f;
-
-        bondManager.registerEntity(def);
+        placement.pose.q = physx::PxQuat(0.0f, std::sin(angle / 2.0f), 0.0f, std::cos(angle / 2.0f));
     }
 
+    bondManager.registerEntities(monomer, placements);
+
     std::cout << "Ring formation scene created with " << numMonomers
               << " monomers, target ring size: " << targetRingSize << std::endl;
 }
@@ -199,21 +200,23 @@ inline void createChainFormationScene(
     // Create chain monomers (each can bond at most 2 sites - linear chain)
     const int numMonomers = 30;
 
+    BondableEntityDef def = BondableEntityDef::createDimer(0.3f);
+    def.entityType = "chain_monomer";
+    def.actorDef.density = 1.0f;
+
+    EntityTemplatePtr monomer = bondManager.registerEntityTemplate(def);
+
+    std::vector<EntityPlacement> placements(numMonomers);
     for (int i = 0; i < numMonomers; ++i)
     {
-        BondableEntityDef def = BondableEntityDef::createDimer(0.3f);
-        def.entityType = "chain_monomer";
-
         // Random positions
-        def.actorDef.posX = posDist(rng);
-        def.actorDef.posY = 3.0f + static_cast<float>(i % 5);
-        def.actorDef.posZ = posDist(rng);
-
-        def.actorDef.density = 1.0f;
-
-        bondManager.registerEntity(def);
+        placements[i].pose.p.x = posDist(rng);
+        placements[i].pose.p.y = 3.0f + static_cast<float>(i % 5);
+        placements[i].pose.p.z = posDist(rng);
     }
 
+    bondManager.registerEntities(monomer, placements);
+
     std::cout << "Chain formation scene created with " << numMonomers << " monomers" << std::endl;
 }
 
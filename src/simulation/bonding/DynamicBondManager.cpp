@@ -10,12 +10,12 @@ namespace bonding
 DynamicBondManager::DynamicBondManager()
 {
     // Register default bond types
-    m_bondTypes["rigid"] = std::make_shared<RigidBondType>();
-    m_bondTypes["compliant"] = std::make_shared<CompliantBondType>();
-    m_bondTypes["hinged"] = std::make_shared<HingedBondType>();
-    m_bondTypes["ball_socket"] = std::make_shared<BallSocketBondType>();
-    m_bondTypes["prismatic"] = std::make_shared<PrismaticBondType>();
-    m_bondTypes["d6"] = std::make_shared<D6BondType>();
+    registerBondType("rigid", std::make_shared<RigidBondType>());
+    registerBondType("compliant", std::make_shared<CompliantBondType>());
+    registerBondType("hinged", std::make_shared<HingedBondType>());
+    registerBondType("ball_socket", std::make_shared<BallSocketBondType>());
+    registerBondType("prismatic", std::make_shared<PrismaticBondType>());
+    registerBondType("d6", std::make_shared<D6BondType>());
 
     // Add default rules
     addRule(std::make_shared<NoSelfBondingRule>());
@@ -32,6 +32,17 @@ DynamicBondManager::~DynamicBondManager()
 
 void DynamicBondManager::initialize(physx::PxPhysics* physics, physx::PxScene* scene)
 {
+    // Cached materials and shapes belong to the old physics object
+    if (physics != m_physics)
+    {
+        m_actorResources.clear();
+    }
+
+    if (scene != m_scene)
+    {
+        detachBreakListener();
+    }
+
     m_physics = physics;
     m_scene = scene;
 }
@@ -39,6 +50,34 @@ void DynamicBondManager::initialize(physx::PxPhysics* physics, physx::PxScene* s
 void DynamicBondManager::configure(const DynamicBondManagerConfig& config)
 {
     m_config = config;
+    invalidateCandidatePairs();
+
+    if (!config.useBreakEvents)
+    {
+        detachBreakListener();
+    }
+
+    // (Re)create the worker pool when the thread count changes
+    uint32_t threads = config.workerThreads;
+    if (threads == 0)
+    {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    if (threads <= 1)
+    {
+        m_workerPool.reset();
+    }
+    else if (!m_workerPool || m_workerPool->getThreadCount() != threads)
+    {
+        m_workerPool = std::make_unique<WorkerPool>(threads);
+    }
+
+    m_ringDetector.setMaxRingSize(config.maxRingSize);
+
+    for (auto& pool : m_jointPools)
+    {
+        pool.setCapacity(config.jointPoolSize);
+    }
 
     // Update proximity rule if it exists
     for (auto& rule : m_rules)
@@ -55,16 +94,44 @@ void DynamicBondManager::configure(const DynamicBondManagerConfig& config)
 // Entity Management
 // =============================================================================
 
+EntityTemplatePtr DynamicBondManager::registerEntityTemplate(const BondableEntityDef& def)
+{
+    internSiteTypes(def);
+    auto entityTemplate = std::make_shared<const EntityTemplate>(def, &m_siteTypes, &m_propertySchema);
+    m_entityTemplates[def.entityType] = entityTemplate;
+    return entityTemplate;
+}
+
+EntityTemplatePtr DynamicBondManager::getEntityTemplate(const std::string& entityType) const
+{
+    auto it = m_entityTemplates.find(entityType);
+    return (it != m_entityTemplates.end()) ? it->second : nullptr;
+}
+
 uint64_t DynamicBondManager::registerEntity(const BondableEntityDef& def, physx::PxRigidActor* existingActor)
 {
-    if (!m_physics || !m_scene)
+    internSiteTypes(def);
+    return registerEntity(
+        std::make_shared<const EntityTemplate>(def, &m_siteTypes, &m_propertySchema),
+        EntityPlacement::fromActorDef(def.actorDef), existingActor);
+}
+
+uint64_t DynamicBondManager::registerEntity(
+    const EntityTemplatePtr& sourceTemplate,
+    const EntityPlacement& placement,
+    physx::PxRigidActor* existingActor)
+{
+    if (!m_physics || !m_scene || !sourceTemplate)
         return 0;
 
+    // Site type masks are only meaningful against our own registry
+    EntityTemplatePtr entityTemplate = adoptTemplate(sourceTemplate);
+
     // Get or create actor
     physx::PxRigidActor* actor = existingActor;
     if (!actor)
     {
-        actor = createActor(def.actorDef);
+        actor = createActor(entityTemplate->getDefinition().actorDef, placement);
         if (!actor)
             return 0;
 
@@ -76,36 +143,151 @@ uint64_t DynamicBondManager::registerEntity(const BondableEntityDef& def, physx:
 
     // Create entity
     auto entity = std::make_unique<BondableEntity>();
-    BondableEntityDef mutableDef = def;
-    mutableDef.entityId = entityId;
-    entity->initialize(mutableDef, actor);
+    entity->initialize(entityTemplate, entityId, actor);
 
     m_entities[entityId] = std::move(entity);
+    m_bondGraph.addNode(entityId);
+    m_clusterTracker.addNode(entityId);
 
     return entityId;
 }
 
+std::vector<uint64_t> DynamicBondManager::registerEntities(const BondableEntityDef* defs, size_t count)
+{
+    if (!m_physics || !m_scene || count == 0)
+        return std::vector<uint64_t>(count, 0);
+
+    // Interning writes the registry, so it runs before the parallel part
+    for (size_t i = 0; i < count; ++i)
+    {
+        internSiteTypes(defs[i]);
+    }
+
+    // Each definition gets a template of its own; copying definitions and
+    // building site tables only reads shared state
+    std::vector<EntityTemplatePtr> templates(count);
+    std::vector<EntityPlacement> placements(count);
+    const size_t taskCount = std::min(getTaskCount(), count);
+    runTasks(taskCount, [&](size_t task)
+    {
+        for (size_t i = count * task / taskCount; i < count * (task + 1) / taskCount; ++i)
+        {
+            templates[i] = std::make_shared<const EntityTemplate>(defs[i], &m_siteTypes, &m_propertySchema);
+            placements[i] = EntityPlacement::fromActorDef(defs[i].actorDef);
+        }
+    });
+
+    return registerEntityBatch(templates.data(), placements.data(), count);
+}
+
+std::vector<uint64_t> DynamicBondManager::registerEntities(
+    const EntityTemplatePtr& entityTemplate, const EntityPlacement* placements, size_t count)
+{
+    if (!entityTemplate)
+        return std::vector<uint64_t>(count, 0);
+
+    std::vector<EntityTemplatePtr> templates(count, adoptTemplate(entityTemplate));
+    return registerEntityBatch(templates.data(), placements, count);
+}
+
+std::vector<uint64_t> DynamicBondManager::registerEntityBatch(
+    const EntityTemplatePtr* templates, const EntityPlacement* placements, size_t count)
+{
+    std::vector<uint64_t> entityIds(count, 0);
+    if (!m_physics || !m_scene || count == 0)
+        return entityIds;
+
+    // Actors are created on this thread: the shared material/shape cache is not synchronised
+    std::vector<physx::PxRigidActor*> actors(count, nullptr);
+    std::vector<physx::PxActor*> sceneActors;
+    sceneActors.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        actors[i] = createActor(templates[i]->getDefinition().actorDef, placements[i]);
+        if (actors[i])
+        {
+            entityIds[i] = m_nextEntityId.fetch_add(1);
+            sceneActors.push_back(actors[i]);
+        }
+    }
+
+    if (sceneActors.empty())
+        return entityIds;
+
+    m_scene->addActors(sceneActors.data(), static_cast<physx::PxU32>(sceneActors.size()));
+
+    const size_t entityCount = m_entities.size() + sceneActors.size();
+    m_entities.reserve(entityCount);
+    m_bondGraph.reserve(entityCount);
+    m_clusterTracker.reserve(entityCount);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (!actors[i])
+            continue;
+
+        auto entity = std::make_unique<BondableEntity>();
+        entity->initialize(templates[i], entityIds[i], actors[i]);
+
+        m_entities[entityIds[i]] = std::move(entity);
+        m_bondGraph.addNode(entityIds[i]);
+        m_clusterTracker.addNode(entityIds[i]);
+    }
+
+    return entityIds;
+}
+
+void DynamicBondManager::internSiteTypes(const BondableEntityDef& def)
+{
+    for (const auto& site : def.bondingSites)
+    {
+        m_siteTypes.intern(site);
+    }
+}
+
+EntityTemplatePtr DynamicBondManager::adoptTemplate(const EntityTemplatePtr& entityTemplate)
+{
+    if (entityTemplate->getSiteTypeRegistryId() == m_siteTypes.getId() &&
+        entityTemplate->getPropertySchemaId() == m_propertySchema.getId())
+        return entityTemplate;
+
+    const BondableEntityDef& def = entityTemplate->getDefinition();
+    internSiteTypes(def);
+    return std::make_shared<const EntityTemplate>(def, &m_siteTypes, &m_propertySchema);
+}
+
 void DynamicBondManager::unregisterEntity(uint64_t entityId)
 {
     auto it = m_entities.find(entityId);
     if (it == m_entities.end())
         return;
 
-    // Break all bonds involving this entity
-    std::vector<uint64_t> bondsToBreak;
-    for (const auto& [bondId, bond] : m_bonds)
+    // Break all bonds involving this entity (copied: breaking edits the edge list)
+    std::vector<BondEdge> edges = m_bondGraph.getEdges(entityId);
+    for (const BondEdge& edge : edges)
     {
-        if (bond.involvesEntity(entityId))
-        {
-            bondsToBreak.push_back(bondId);
-        }
+        const Bond* stored = m_bonds.find(edge.bondId);
+        if (!stored)
+            continue;
+
+        Bond bond = *stored;
+        detachBond(bond);
+        m_bonds.erase(edge.bondId);
+        m_bondsBrokenThisFrame++;
+        queueBondBroken(bond, false);
     }
 
-    for (uint64_t bondId : bondsToBreak)
+    // Joints go before the actor they are attached to
+    releaseQueuedJoints();
+    for (auto& pool : m_jointPools)
     {
-        breakBond(bondId);
+        pool.releaseAttachedTo(it->second->getActor());
     }
 
+    untrackEntity(*it->second);
+    m_bondGraph.removeNode(entityId);
+    m_clusterTracker.removeNode(entityId);
+
     // Remove actor from scene
     physx::PxRigidActor* actor = it->second->getActor();
     if (actor && m_scene)
@@ -115,6 +297,11 @@ void DynamicBondManager::unregisterEntity(uint64_t entityId)
     }
 
     m_entities.erase(it);
+
+    if (!m_updating)
+    {
+        applyBondCommands();
+    }
 }
 
 BondableEntity* DynamicBondManager::getEntity(uint64_t entityId)
@@ -147,6 +334,7 @@ std::vector<uint64_t> DynamicBondManager::getEntityIds() const
 void DynamicBondManager::addRule(BondFormationRulePtr rule)
 {
     m_rules.push_back(std::move(rule));
+    invalidateCandidatePairs();
 
     // Sort by priority (descending)
     std::sort(m_rules.begin(), m_rules.end(),
@@ -165,11 +353,13 @@ void DynamicBondManager::removeRule(const std::string& ruleName)
                 return rule->getName() == ruleName;
             }),
         m_rules.end());
+    invalidateCandidatePairs();
 }
 
 void DynamicBondManager::clearRules()
 {
     m_rules.clear();
+    invalidateCandidatePairs();
 }
 
 // =============================================================================
@@ -178,24 +368,57 @@ void DynamicBondManager::clearRules()
 
 void DynamicBondManager::registerBondType(const std::string& name, BondTypePtr bondType)
 {
-    m_bondTypes[name] = std::move(bondType);
+    // Re-registering a name keeps its ID, so existing bonds keep their type
+    auto it = m_bondTypeIds.find(name);
+    if (it != m_bondTypeIds.end())
+    {
+        // Pooled joints were made by the old type and may not fit the new one
+        m_jointPools[it->second].clear();
+        m_bondTypes[it->second] = std::move(bondType);
+        return;
+    }
+
+    if (m_bondTypes.size() >= kInvalidBondType)
+        return;
+
+    m_bondTypeIds[name] = static_cast<BondTypeId>(m_bondTypes.size());
+    m_bondTypes.push_back(std::move(bondType));
+    m_bondTypeNames.push_back(name);
+    m_jointPools.emplace_back();
+    m_jointPools.back().setCapacity(m_config.jointPoolSize);
 }
 
 IBondType* DynamicBondManager::getBondType(const std::string& name)
 {
-    auto it = m_bondTypes.find(name);
-    return (it != m_bondTypes.end()) ? it->second.get() : nullptr;
+    BondTypeId typeId = getBondTypeId(name);
+    return (typeId != kInvalidBondType) ? m_bondTypes[typeId].get() : nullptr;
 }
 
 const IBondType* DynamicBondManager::getBondType(const std::string& name) const
 {
-    auto it = m_bondTypes.find(name);
-    return (it != m_bondTypes.end()) ? it->second.get() : nullptr;
+    return getBondType(getBondTypeId(name));
+}
+
+const IBondType* DynamicBondManager::getBondType(BondTypeId typeId) const
+{
+    return (typeId < m_bondTypes.size()) ? m_bondTypes[typeId].get() : nullptr;
+}
+
+BondTypeId DynamicBondManager::getBondTypeId(const std::string& name) const
+{
+    auto it = m_bondTypeIds.find(name);
+    return (it != m_bondTypeIds.end()) ? it->second : kInvalidBondType;
+}
+
+const std::string& DynamicBondManager::getBondTypeName(BondTypeId typeId) const
+{
+    static const std::string kUnknown;
+    return (typeId < m_bondTypeNames.size()) ? m_bondTypeNames[typeId] : kUnknown;
 }
 
 void DynamicBondManager::setDefaultBondType(const std::string& name)
 {
-    if (m_bondTypes.find(name) != m_bondTypes.end())
+    if (getBondTypeId(name) != kInvalidBondType)
     {
         m_config.defaultBondType = name;
     }
@@ -223,56 +446,48 @@ uint64_t DynamicBondManager::createBond(
     // Use provided bond type or default
     std::string typeName = bondTypeName.empty() ? m_config.defaultBondType : bondTypeName;
 
-    return createBondInternal(*e1, site1Id, *e2, site2Id, typeName, bondConfig);
+    uint64_t bondId = createBondInternal(*e1, site1Id, *e2, site2Id, typeName, bondConfig, false);
+
+    // Outside update() the bond is applied right away
+    if (bondId != 0 && !m_updating)
+    {
+        applyBondCommands();
+        if (!m_bonds.contains(bondId))
+            return 0;
+    }
+
+    return bondId;
 }
 
 void DynamicBondManager::breakBond(uint64_t bondId)
 {
-    auto it = m_bonds.find(bondId);
-    if (it == m_bonds.end())
+    const Bond* stored = m_bonds.find(bondId);
+    if (!stored)
         return;
 
-    Bond& bond = it->second;
-
-    // Release the PhysX joint
-    if (bond.joint)
-    {
-        bond.joint->release();
-        bond.joint = nullptr;
-    }
+    Bond bond = *stored;
+    detachBond(bond);
+    m_bonds.erase(bondId);
+    m_bondsBrokenThisFrame++;
 
-    // Update entity bond records
-    if (BondableEntity* e1 = getEntity(bond.endpoint1.entityId))
-    {
-        e1->removeBond(bond.endpoint1.siteId, bondId);
-    }
-    if (BondableEntity* e2 = getEntity(bond.endpoint2.entityId))
+    queueBondBroken(bond, false);
+    if (!m_updating)
     {
-        e2->removeBond(bond.endpoint2.siteId, bondId);
+        applyBondCommands();
     }
-
-    // Fire callback
-    fireBondBroken(bond, false);
-
-    // Remove from map
-    m_bonds.erase(it);
-    m_bondsBrokenThisFrame++;
-}
-
-const Bond* DynamicBondManager::getBond(uint64_t bondId) const
-{
-    auto it = m_bonds.find(bondId);
-    return (it != m_bonds.end()) ? &it->second : nullptr;
 }
 
 std::vector<const Bond*> DynamicBondManager::getBondsForEntity(uint64_t entityId) const
 {
+    const auto& edges = m_bondGraph.getEdges(entityId);
+
     std::vector<const Bond*> result;
-    for (const auto& [bondId, bond] : m_bonds)
+    result.reserve(edges.size());
+    for (const BondEdge& edge : edges)
     {
-        if (bond.involvesEntity(entityId))
+        if (const Bond* bond = getBond(edge.bondId))
         {
-            result.push_back(&bond);
+            result.push_back(bond);
         }
     }
     return result;
@@ -291,58 +506,57 @@ void DynamicBondManager::update(float dt)
     m_timeSinceLastCheck += dt;
     m_bondsFormedThisFrame = 0;
     m_bondsBrokenThisFrame = 0;
+    m_updating = true;
 
-    // Check for broken bonds
-    checkBrokenBonds();
+    // Check for broken bonds: only the reported ones while the listener is
+    // installed, otherwise (and on the frame it gets installed) every joint
+    if (m_config.useBreakEvents && attachBreakListener())
+    {
+        processBreakEvents();
+    }
+    else
+    {
+        checkBrokenBonds();
+    }
 
     // Check for new bonds periodically
     if (m_timeSinceLastCheck >= m_config.proximityCheckInterval)
     {
         m_timeSinceLastCheck = 0.0f;
 
-        // Update spatial hash
-        if (m_config.enableSpatialHashing)
-        {
-            updateSpatialHash();
-        }
-
-        // Find and create bonds
-        auto candidates = findBondCandidates();
+        // Read poses once for everything that may have moved
+        refreshSiteTransforms();
 
-        // Sort by score (descending)
-        std::sort(candidates.begin(), candidates.end(),
-            [](const BondCandidate& a, const BondCandidate& b)
-            {
-                return a.score > b.score;
-            });
-
-        // Create bonds (limited by maxBondsPerFrame)
-        for (size_t i = 0; i < candidates.size() && m_bondsFormedThisFrame < m_config.maxBondsPerFrame; ++i)
+        if (!m_config.adaptiveProximityChecks || needsCandidateSearch())
         {
-            const auto& candidate = candidates[i];
-
-            BondableEntity* e1 = getEntity(candidate.entity1Id);
-            BondableEntity* e2 = getEntity(candidate.entity2Id);
-
-            if (!e1 || !e2)
-                continue;
-
-            // Verify sites are still available (might have been taken by earlier bonds)
-            if (!e1->canBondAt(candidate.site1Id) || !e2->canBondAt(candidate.site2Id))
-                continue;
-
-            uint64_t bondId = createBondInternal(
-                *e1, candidate.site1Id,
-                *e2, candidate.site2Id,
-                m_config.defaultBondType,
-                m_config.defaultBondConfig);
-
-            if (bondId != 0)
+            // Update spatial hash; with pair lists only when the list is rebuilt
+            const bool rebuildPairs =
+                m_config.enableSpatialHashing && m_config.useVerletLists && needsVerletRebuild();
+            if (m_config.enableSpatialHashing && (!m_config.useVerletLists || rebuildPairs))
+            {
+                updateSpatialHash();
+            }
+            if (rebuildPairs)
             {
-                m_bondsFormedThisFrame++;
+                buildVerletPairs();
             }
+
+            // Find and create bonds; rules read site transforms from the cache
+            m_siteTransforms.setActive(true);
+            auto candidates = findBondCandidates();
+            m_siteTransforms.setActive(false);
+
+            commitCandidates(candidates);
+        }
+        else
+        {
+            m_skippedProximityChecks++;
         }
     }
+
+    // Apply this update's joint changes in one go and report them
+    m_updating = false;
+    applyBondCommands();
 }
 
 // =============================================================================
@@ -359,10 +573,16 @@ void DynamicBondManager::onBondBroken(BondBrokenCallback callback)
     m_bondBrokenCallbacks.push_back(std::move(callback));
 }
 
+void DynamicBondManager::onBondEvents(BondEventBatchCallback callback)
+{
+    m_bondEventCallbacks.push_back(std::move(callback));
+}
+
 void DynamicBondManager::clearCallbacks()
 {
     m_bondFormedCallbacks.clear();
     m_bondBrokenCallbacks.clear();
+    m_bondEventCallbacks.clear();
 }
 
 // =============================================================================
@@ -376,6 +596,7 @@ BondManagerStats DynamicBondManager::getStats() const
     stats.bondCount = m_bonds.size();
     stats.bondsFormedThisFrame = m_bondsFormedThisFrame;
     stats.bondsBrokenThisFrame = m_bondsBrokenThisFrame;
+    stats.skippedProximityChecks = m_skippedProximityChecks;
     stats.lastUpdateTime = m_simulationTime;
 
     size_t availableSites = 0;
@@ -383,8 +604,7 @@ BondManagerStats DynamicBondManager::getStats() const
 
     for (const auto& [id, entity] : m_entities)
     {
-        auto available = entity->getAvailableSites();
-        availableSites += available.size();
+        availableSites += entity->getAvailableSiteCount();
         if (entity->isFullySaturated())
         {
             saturatedEntities++;
@@ -403,27 +623,47 @@ BondManagerStats DynamicBondManager::getStats() const
 
 void DynamicBondManager::releaseAllBonds()
 {
+    // Queued joint work is dropped along with the bonds
+    releaseQueuedJoints();
+    m_commands.clear();
+
     // Release all joints
-    for (auto& [bondId, bond] : m_bonds)
+    for (physx::PxJoint* joint : m_bonds.getJoints())
     {
-        if (bond.joint)
+        if (joint)
         {
-            bond.joint->release();
-            bond.joint = nullptr;
+            joint->release();
         }
     }
     m_bonds.clear();
+    m_jointBonds.clear();
+    m_bondGraph.clearEdges();
+    m_clusterTracker.clearEdges();
+    m_ringDetector.clear();
+    invalidateCandidatePairs();
 
     // Clear bond records from entities
     for (auto& [entityId, entity] : m_entities)
     {
         entity->clearAllBonds();
+        for (const auto& site : entity->getAllSites())
+        {
+            refreshGridSite(*entity, site.siteId);
+        }
     }
 }
 
 void DynamicBondManager::releaseAll()
 {
     releaseAllBonds();
+    detachBreakListener();
+
+    for (auto& pool : m_jointPools)
+    {
+        pool.clear();
+    }
+
+    m_siteTransforms.clear();
 
     // Release all actors
     for (auto& [entityId, entity] : m_entities)
@@ -436,31 +676,36 @@ void DynamicBondManager::releaseAll()
         }
     }
     m_entities.clear();
+    m_bondGraph.clear();
+    m_clusterTracker.clear();
+    m_ringDetector.clear();
+    m_actorResources.clear();
 
     m_simulationTime = 0.0f;
     m_timeSinceLastCheck = 0.0f;
-    m_spatialHash.clear();
+    m_siteGrid.clear();
+    m_gridSites.clear();
+    m_entityTracking.clear();
+
+    invalidateCandidatePairs();
+    m_searchPositions.clear();
+    m_skippedProximityChecks = 0;
+    m_verletPairs.clear();
+    m_verletPositions.clear();
 }
 
 // =============================================================================
 // Internal Methods
 // =============================================================================
 
-physx::PxRigidActor* DynamicBondManager::createActor(const ActorDef& def)
+physx::PxRigidActor* DynamicBondManager::createActor(const ActorDef& def, const EntityPlacement& placement)
 {
     if (!m_physics)
         return nullptr;
 
-    // Create transform
-    physx::PxTransform transform(
-        physx::PxVec3(def.posX, def.posY, def.posZ),
-        physx::PxQuat(def.quatX, def.quatY, def.quatZ, def.quatW));
-
-    // Create material
-    physx::PxMaterial* material = m_physics->createMaterial(
-        def.staticFriction, def.dynamicFriction, def.restitution);
-
-    if (!material)
+    // Material and shape are shared with every entity of the same definition
+    physx::PxShape* shape = m_actorResources.getShape(*m_physics, def);
+    if (!shape)
         return nullptr;
 
     // Create actor based on type
@@ -468,311 +713,939 @@ physx::PxRigidActor* DynamicBondManager::createActor(const ActorDef& def)
 
     if (def.type == ActorDef::Type::STATIC)
     {
-        actor = m_physics->createRigidStatic(transform);
+        actor = m_physics->createRigidStatic(placement.pose);
     }
     else
     {
-        physx::PxRigidDynamic* dynamic = m_physics->createRigidDynamic(transform);
+        physx::PxRigidDynamic* dynamic = m_physics->createRigidDynamic(placement.pose);
         if (dynamic)
         {
             // Set initial velocity
-            dynamic->setLinearVelocity(physx::PxVec3(def.velX, def.velY, def.velZ));
-            dynamic->setAngularVelocity(physx::PxVec3(def.angVelX, def.angVelY, def.angVelZ));
+            dynamic->setLinearVelocity(placement.linearVelocity);
+            dynamic->setAngularVelocity(placement.angularVelocity);
         }
         actor = dynamic;
     }
 
     if (!actor)
-    {
-        material->release();
         return nullptr;
-    }
 
-    // Create shape based on geometry type
-    physx::PxShape* shape = nullptr;
+    actor->attachShape(*shape);
 
-    switch (def.geomType)
+    // Update mass for dynamic actors
+    if (def.type == ActorDef::Type::DYNAMIC)
     {
-    case ActorDef::GeomType::SPHERE:
-        shape = m_physics->createShape(physx::PxSphereGeometry(def.sphereRadius), *material);
-        break;
-
-    case ActorDef::GeomType::BOX:
-        shape = m_physics->createShape(
-            physx::PxBoxGeometry(def.boxHalfX, def.boxHalfY, def.boxHalfZ), *material);
-        break;
+        physx::PxRigidBodyExt::updateMassAndInertia(
+            *static_cast<physx::PxRigidDynamic*>(actor), def.density);
+    }
 
-    case ActorDef::GeomType::CAPSULE:
-        shape = m_physics->createShape(
-            physx::PxCapsuleGeometry(def.capsuleRadius, def.capsuleHalfHeight), *material);
-        break;
+    return actor;
+}
 
-    default:
-        // Default to sphere
-        shape = m_physics->createShape(physx::PxSphereGeometry(0.5f), *material);
-        break;
-    }
+void DynamicBondManager::checkBrokenBonds()
+{
+    std::vector<uint64_t> brokenBonds;
 
-    if (shape)
+    // Walk the contiguous joint array in dense order
+    const auto& joints = m_bonds.getJoints();
+    for (size_t i = 0; i < joints.size(); ++i)
     {
-        actor->attachShape(*shape);
-        shape->release(); // Actor holds reference
+        physx::PxJoint* joint = joints[i];
+
+        bool broken = !joint || m_bonds.at(i).pendingRemoval ||
+                      (joint->getConstraintFlags() & physx::PxConstraintFlag::eBROKEN);
+        if (!broken)
+        {
+            physx::PxRigidActor* actor0 = nullptr;
+            physx::PxRigidActor* actor1 = nullptr;
+            joint->getActors(actor0, actor1);
+            broken = !actor0 || !actor1;
+        }
 
-        // Update mass for dynamic actors
-        if (def.type == ActorDef::Type::DYNAMIC)
+        if (broken)
         {
-            physx::PxRigidBodyExt::updateMassAndInertia(
-                *static_cast<physx::PxRigidDynamic*>(actor), def.density);
+            brokenBonds.push_back(m_bonds.at(i).bondId);
         }
     }
 
-    material->release(); // Shape holds reference
+    for (uint64_t bondId : brokenBonds)
+    {
+        removeBrokenBond(bondId);
+    }
 
-    return actor;
+    // Every joint was checked, so queued events are already covered
+    m_breakListener.takeBrokenJoints(m_brokenJoints);
 }
 
-void DynamicBondManager::checkBrokenBonds()
+void DynamicBondManager::processBreakEvents()
 {
-    std::vector<uint64_t> brokenBonds;
+    m_breakListener.takeBrokenJoints(m_brokenJoints);
 
-    for (auto& [bondId, bond] : m_bonds)
+    for (physx::PxJoint* joint : m_brokenJoints)
     {
-        if (!bond.isValid())
+        // Joints that are not bonds (or bonds already removed) are ignored.
+        // A joint found here is live, but its address may have been reused by
+        // a bond formed after the event, so it must itself be broken.
+        auto it = m_jointBonds.find(joint);
+        if (it != m_jointBonds.end() &&
+            (joint->getConstraintFlags() & physx::PxConstraintFlag::eBROKEN))
         {
-            brokenBonds.push_back(bondId);
+            removeBrokenBond(it->second);
         }
     }
+}
 
-    for (uint64_t bondId : brokenBonds)
+void DynamicBondManager::removeBrokenBond(uint64_t bondId)
+{
+    const Bond* stored = m_bonds.find(bondId);
+    if (!stored)
+        return;
+
+    Bond bond = *stored;
+    detachBond(bond);
+    m_bonds.erase(bondId);
+    m_bondsBrokenThisFrame++;
+
+    queueBondBroken(bond, true);
+}
+
+void DynamicBondManager::detachBond(const Bond& bond)
+{
+    if (BondableEntity* e1 = getEntity(bond.endpoint1.entityId))
+    {
+        e1->removeBond(bond.endpoint1.siteId, bond.bondId);
+        refreshGridSite(*e1, bond.endpoint1.siteId);
+    }
+    if (BondableEntity* e2 = getEntity(bond.endpoint2.entityId))
+    {
+        e2->removeBond(bond.endpoint2.siteId, bond.bondId);
+        refreshGridSite(*e2, bond.endpoint2.siteId);
+    }
+
+    m_bondGraph.removeEdge(bond);
+    m_clusterTracker.removeEdge(bond);
+    m_ringDetector.onBondRemoved(bond.bondId, m_simulationTime);
+    invalidateCandidatePairs();
+
+    if (bond.joint)
     {
-        auto it = m_bonds.find(bondId);
-        if (it != m_bonds.end())
+        m_jointBonds.erase(bond.joint);
+    }
+}
+
+void DynamicBondManager::queueBondBroken(const Bond& bond, bool wasBreakForce)
+{
+    if (bond.joint)
+    {
+        // A joint broken by force stays broken, so only manual breaks are pooled
+        BondTypeId poolType = wasBreakForce ? kInvalidBondType : bond.typeId;
+        m_commands.releases.push_back({bond.joint, poolType});
+    }
+
+    // Callbacks never see the joint; it is released before they run
+    BondBrokenEvent event{bond, m_simulationTime, wasBreakForce};
+    event.bond.joint = nullptr;
+    m_commands.broken.push_back(event);
+}
+
+void DynamicBondManager::applyBondCommands()
+{
+    // A callback fired below may queue more; the outer call picks them up
+    if (m_applyingBondCommands)
+        return;
+    m_applyingBondCommands = true;
+
+    while (!m_commands.empty())
+    {
+        BondCommandBuffer& batch = m_applyingCommands;
+        std::swap(batch, m_commands);
+
+        // Retired first, so formations below can reuse them
+        for (const auto& release : batch.releases)
         {
-            Bond& bond = it->second;
+            retireJoint(release);
+        }
+
+        for (const auto& formation : batch.formations)
+        {
+            // Broken again before it was applied
+            const Bond* stored = m_bonds.find(formation.bondId);
+            if (!stored)
+                continue;
 
-            // Update entity records
-            if (BondableEntity* e1 = getEntity(bond.endpoint1.entityId))
+            physx::PxJoint* joint = acquireJoint(formation, *stored);
+
+            if (!joint)
             {
-                e1->removeBond(bond.endpoint1.siteId, bondId);
+                // Undo the bond; it is never reported or counted
+                m_ringDetector.onBondUndone(formation.bondId);
+                detachBond(*stored);
+                m_bonds.erase(formation.bondId);
+                batch.formed[formation.formedIndex].bondId = 0;
+                if (formation.countedAsFormed && m_bondsFormedThisFrame > 0)
+                {
+                    m_bondsFormedThisFrame--;
+                }
+                continue;
             }
-            if (BondableEntity* e2 = getEntity(bond.endpoint2.entityId))
+
+            m_bonds.setJoint(formation.bondId, joint);
+            m_jointBonds[joint] = formation.bondId;
+            batch.formed[formation.formedIndex].joint = joint;
+        }
+
+        // Breaks first, as they were detected before the formations
+        for (const auto& event : batch.broken)
+        {
+            fireBondBroken(event.bond, event.wasBreakForce);
+        }
+        for (const Bond& bond : batch.formed)
+        {
+            if (bond.bondId != 0)
             {
-                e2->removeBond(bond.endpoint2.siteId, bondId);
+                fireBondFormed(bond);
             }
+        }
 
-            // Fire callback (broken by force)
-            fireBondBroken(bond, true);
+        if (!m_bondEventCallbacks.empty())
+        {
+            BondEventBatch events;
+            events.broken = batch.broken;
+            events.formed.reserve(batch.formed.size());
+            for (const Bond& bond : batch.formed)
+            {
+                if (bond.bondId != 0)
+                {
+                    events.formed.push_back({bond, m_simulationTime});
+                }
+            }
 
-            // Release joint if still valid
-            if (bond.joint)
+            if (!events.formed.empty() || !events.broken.empty())
             {
-                bond.joint->release();
+                for (const auto& callback : m_bondEventCallbacks)
+                {
+                    callback(events);
+                }
             }
+        }
 
-            m_bonds.erase(it);
-            m_bondsBrokenThisFrame++;
+        batch.clear();
+    }
+
+    m_applyingBondCommands = false;
+}
+
+void DynamicBondManager::releaseQueuedJoints()
+{
+    for (const auto& release : m_commands.releases)
+    {
+        release.joint->release();
+    }
+    m_commands.releases.clear();
+}
+
+physx::PxJoint* DynamicBondManager::acquireJoint(const BondCommandBuffer::Formation& formation, const Bond& bond)
+{
+    if (bond.typeId < m_jointPools.size())
+    {
+        if (physx::PxJoint* joint = m_jointPools[bond.typeId].acquire())
+        {
+            if (formation.bondType->reconfigureJoint(
+                    joint, formation.actor1, formation.frame1,
+                    formation.actor2, formation.frame2, bond, formation.config))
+            {
+                joint->setConstraintFlag(physx::PxConstraintFlag::eDISABLE_CONSTRAINT, false);
+                return joint;
+            }
+
+            // The type cannot reuse pooled joints; drop the rest of its pool too
+            joint->release();
+            m_jointPools[bond.typeId].clear();
         }
     }
+
+    return formation.bondType->createJoint(
+        m_physics, formation.actor1, formation.frame1,
+        formation.actor2, formation.frame2, bond, formation.config);
 }
 
-void DynamicBondManager::updateSpatialHash()
+void DynamicBondManager::retireJoint(const BondCommandBuffer::Release& release)
+{
+    // eBROKEN cannot be cleared, so a joint that broke in the meantime is not reusable
+    bool reusable = release.poolType < m_jointPools.size() &&
+        !(release.joint->getConstraintFlags() & physx::PxConstraintFlag::eBROKEN);
+
+    if (!reusable || !m_jointPools[release.poolType].park(release.joint))
+    {
+        release.joint->release();
+    }
+}
+
+bool DynamicBondManager::attachBreakListener()
 {
-    m_spatialHash.clear();
+    if (!m_scene)
+        return false;
+
+    physx::PxSimulationEventCallback* current = m_scene->getSimulationEventCallback();
+    if (m_breakListenerAttached && current == &m_breakListener)
+        return true;
+
+    // Not installed yet, or replaced since: chain whatever is there now
+    if (current != &m_breakListener)
+    {
+        m_breakListener.setChainedCallback(current);
+        m_scene->setSimulationEventCallback(&m_breakListener);
+    }
+    m_breakListenerAttached = true;
+    return false;
+}
+
+void DynamicBondManager::detachBreakListener()
+{
+    if (m_breakListenerAttached && m_scene &&
+        m_scene->getSimulationEventCallback() == &m_breakListener)
+    {
+        m_scene->setSimulationEventCallback(m_breakListener.getChainedCallback());
+    }
+
+    m_breakListenerAttached = false;
+    m_breakListener.clear();
+}
+
+void DynamicBondManager::refreshSiteTransforms()
+{
+    m_refreshEntities.clear();
 
     for (const auto& [entityId, entity] : m_entities)
     {
-        for (const auto& site : entity->getAllSites())
+        auto trackingIt = m_entityTracking.find(entityId);
+        if (trackingIt == m_entityTracking.end())
         {
-            if (!entity->canBondAt(site.siteId))
+            // First time we see this entity: capture its transforms
+            m_siteTransforms.addEntity(*entity);
+            m_entityTracking.emplace(entityId, EntityTracking());
+            invalidateCandidatePairs();
+            continue;
+        }
+
+        EntityTracking& tracking = trackingIt->second;
+
+        // Static actors and actors asleep at both checks usually keep their
+        // pose, but may still have been moved (setGlobalPose without waking, or
+        // woken, moved and asleep again between checks). Their site transforms
+        // are only skipped while the pose matches the cached one.
+        physx::PxRigidActor* actor = entity->getActor();
+        if (!actor)
+            continue;
+
+        const physx::PxRigidDynamic* dynamic = actor->is<physx::PxRigidDynamic>();
+        bool wasAwake = tracking.awake;
+        tracking.awake = dynamic && !dynamic->isSleeping();
+        if (!tracking.awake && !wasAwake &&
+            actor->getGlobalPose() == m_siteTransforms.getPose(entity->getTransformRecord()))
+            continue;
+
+        m_refreshEntities.push_back(entity.get());
+        tracking.moved = true;
+    }
+
+    // Each entity writes only its own cache range, so refreshes can run in parallel
+    const bool trackSearch = m_config.adaptiveProximityChecks;
+    const bool trackVerlet = m_config.useVerletLists && m_config.enableSpatialHashing;
+    const size_t refreshCount = m_refreshEntities.size();
+    const size_t taskCount = std::min(getTaskCount(), refreshCount);
+    m_taskDisplacements.assign(taskCount, TaskDisplacement());
+    runTasks(taskCount, [&](size_t task)
+    {
+        TaskDisplacement& displacement = m_taskDisplacements[task];
+
+        size_t first = refreshCount * task / taskCount;
+        size_t last = refreshCount * (task + 1) / taskCount;
+        for (size_t i = first; i < last; ++i)
+        {
+            const BondableEntity& entity = *m_refreshEntities[i];
+            m_siteTransforms.refresh(entity);
+
+            // Only sites that can still bond matter to the scheduler and pair lists
+            if (entity.getAvailableSiteCount() == 0)
                 continue;
 
-            physx::PxVec3 pos = entity->getSiteWorldPosition(site.siteId);
-            int64_t key = getSpatialKey(pos);
-            m_spatialHash[key].sites.push_back({entityId, site.siteId});
+            if (trackSearch)
+            {
+                displacement.sinceSearch = std::max(
+                    displacement.sinceSearch, getSiteDisplacement(entity, m_searchPositions));
+            }
+            if (trackVerlet)
+            {
+                displacement.sinceVerletBuild = std::max(
+                    displacement.sinceVerletBuild, getSiteDisplacement(entity, m_verletPositions));
+            }
+        }
+    });
+
+    for (const TaskDisplacement& displacement : m_taskDisplacements)
+    {
+        m_maxSiteDisplacement = std::max(m_maxSiteDisplacement, displacement.sinceSearch);
+        m_maxVerletDisplacement = std::max(m_maxVerletDisplacement, displacement.sinceVerletBuild);
+    }
+
+    if (trackSearch)
+    {
+        for (const BondableEntity* entity : m_refreshEntities)
+        {
+            if (entity->getAvailableSiteCount() > 0)
+            {
+                m_sitesMovedSinceSearch = true;
+                break;
+            }
         }
     }
+    m_refreshEntities.clear();
+}
+
+float DynamicBondManager::getSiteDisplacement(
+    const BondableEntity& entity, const std::vector<physx::PxVec3>& reference) const
+{
+    const uint32_t firstSite = m_siteTransforms.getFirstSiteIndex(entity.getTransformRecord());
+    const size_t siteCount = entity.getSiteCount();
+    if (firstSite + siteCount > reference.size())
+        return PX_MAX_F32;
+
+    float maxDistance2 = 0.0f;
+    for (size_t i = 0; i < siteCount; ++i)
+    {
+        const physx::PxVec3 delta =
+            m_siteTransforms.getPosition(firstSite + static_cast<uint32_t>(i)) - reference[firstSite + i];
+        maxDistance2 = std::max(maxDistance2, delta.magnitudeSquared());
+    }
+    return std::sqrt(maxDistance2);
 }
 
-int64_t DynamicBondManager::getSpatialKey(const physx::PxVec3& pos) const
+bool DynamicBondManager::needsCandidateSearch() const
 {
-    int32_t x = static_cast<int32_t>(std::floor(pos.x / m_config.spatialCellSize));
-    int32_t y = static_cast<int32_t>(std::floor(pos.y / m_config.spatialCellSize));
-    int32_t z = static_cast<int32_t>(std::floor(pos.z / m_config.spatialCellSize));
+    if (m_candidateSearchNeeded)
+        return true;
+
+    // Nothing that can bond has moved: the search would see the same state
+    if (!m_sitesMovedSinceSearch)
+        return false;
+
+    // Pairs in range may score differently after any motion (e.g. alignment)
+    if (m_searchFoundPairs)
+        return true;
+
+    // Two sites close in on each other by at most twice the largest displacement
+    return 2.0f * m_maxSiteDisplacement >= m_searchClearance;
+}
 
-    // Pack into 64-bit key (21 bits per dimension + sign)
-    return (static_cast<int64_t>(x) & 0x1FFFFF) |
-           ((static_cast<int64_t>(y) & 0x1FFFFF) << 21) |
-           ((static_cast<int64_t>(z) & 0x1FFFFF) << 42);
+bool DynamicBondManager::needsVerletRebuild() const
+{
+    // Pairs left out were farther apart than capture range + skin
+    return m_verletPairsStale || 2.0f * m_maxVerletDisplacement >= getProximitySkin();
 }
 
-std::vector<int64_t> DynamicBondManager::getNeighborCells(const physx::PxVec3& pos) const
+void DynamicBondManager::buildVerletPairs()
 {
-    std::vector<int64_t> neighbors;
-    neighbors.reserve(27);
+    const float captureRadius = getCandidateSearchRadius();
+    const float searchRadius = std::min(captureRadius + getProximitySkin(), m_siteGrid.getCellSize());
+    const size_t cellCount = m_siteGrid.getCellCount();
+    const bool filterSiteTypes = hasRule<TypeCompatibilityRule>();
 
-    float cellSize = m_config.spatialCellSize;
-    for (int dx = -1; dx <= 1; ++dx)
+    const size_t taskCount = std::max<size_t>(1, std::min(getTaskCount(), cellCount));
+    m_scoringScratch.resize(std::max(m_scoringScratch.size(), taskCount));
+
+    runTasks(taskCount, [&](size_t task)
     {
-        for (int dy = -1; dy <= 1; ++dy)
+        std::vector<VerletPair>& pairs = m_scoringScratch[task].verletPairs;
+        pairs.clear();
+
+        m_siteGrid.forEachPairInCells(
+            cellCount * task / taskCount, cellCount * (task + 1) / taskCount, searchRadius,
+            [&](uint32_t a, uint32_t b)
         {
-            for (int dz = -1; dz <= 1; ++dz)
+            const GridSite* first = &m_gridSites[a];
+            const GridSite* second = &m_gridSites[b];
+
+            if (!isGridPairBondable(*first, *second, filterSiteTypes))
+                return;
+
+            if (first->entity->getEntityId() > second->entity->getEntityId())
+                std::swap(first, second);
+
+            VerletPair pair;
+            pair.entity1 = first->entity;
+            pair.entity2 = second->entity;
+            pair.site1Id = first->siteId;
+            pair.site2Id = second->siteId;
+            pair.position1 = m_siteTransforms.getFirstSiteIndex(first->entity->getTransformRecord()) +
+                static_cast<uint32_t>(first->entity->getSiteIndex(first->siteId));
+            pair.position2 = m_siteTransforms.getFirstSiteIndex(second->entity->getTransformRecord()) +
+                static_cast<uint32_t>(second->entity->getSiteIndex(second->siteId));
+            pairs.push_back(pair);
+        });
+    });
+
+    // Merge in task order
+    m_verletPairs.clear();
+    for (size_t task = 0; task < taskCount; ++task)
+    {
+        auto& pairs = m_scoringScratch[task].verletPairs;
+        m_verletPairs.insert(m_verletPairs.end(), pairs.begin(), pairs.end());
+        pairs.clear();
+    }
+
+    m_verletPairsStale = false;
+    m_maxVerletDisplacement = 0.0f;
+
+    const physx::PxVec3* positions = m_siteTransforms.getPositions();
+    m_verletPositions.assign(positions, positions + m_siteTransforms.getSiteSlotCount());
+}
+
+void DynamicBondManager::updateSpatialHash()
+{
+    // Cells must be at least as large as the search radius for the stencil to cover it
+    m_siteGrid.setCellSize(std::max(m_config.spatialCellSize, getCandidateSearchRadius() + getProximitySkin()));
+
+    for (auto& [entityId, tracking] : m_entityTracking)
+    {
+        BondableEntity* entity = getEntity(entityId);
+        if (!entity)
+            continue;
+
+        const auto& sites = entity->getAllSites();
+        const uint32_t firstSite = m_siteTransforms.getFirstSiteIndex(entity->getTransformRecord());
+
+        if (tracking.gridSlots.empty() && !sites.empty())
+        {
+            // Not in the grid yet: give every site a slot
+            tracking.gridSlots.reserve(sites.size());
+            for (size_t i = 0; i < sites.size(); ++i)
             {
-                physx::PxVec3 neighborPos(
-                    pos.x + dx * cellSize,
-                    pos.y + dy * cellSize,
-                    pos.z + dz * cellSize);
-                neighbors.push_back(getSpatialKey(neighborPos));
+                uint32_t slot = m_siteGrid.addSite(
+                    m_siteTransforms.getPosition(firstSite + static_cast<uint32_t>(i)),
+                    entity->canBondAt(sites[i].siteId));
+                if (slot >= m_gridSites.size())
+                {
+                    m_gridSites.resize(slot + 1);
+                }
+                m_gridSites[slot] = {entity, sites[i].siteId, entity->getSiteTypeMask(i)};
+                tracking.gridSlots.push_back(slot);
             }
+            tracking.moved = false;
+            continue;
         }
+
+        if (!tracking.moved)
+            continue;
+
+        for (size_t i = 0; i < sites.size(); ++i)
+        {
+            m_siteGrid.moveSite(tracking.gridSlots[i],
+                m_siteTransforms.getPosition(firstSite + static_cast<uint32_t>(i)));
+        }
+        tracking.moved = false;
     }
 
-    return neighbors;
+    m_siteGrid.update();
+}
+
+uint32_t DynamicBondManager::getGridSlot(const BondableEntity& entity, uint32_t siteId) const
+{
+    auto trackingIt = m_entityTracking.find(entity.getEntityId());
+    if (trackingIt == m_entityTracking.end() || trackingIt->second.gridSlots.empty())
+        return SiteSpatialGrid::kInvalidSlot;
+
+    int32_t index = entity.getSiteIndex(siteId);
+    return (index >= 0) ? trackingIt->second.gridSlots[index] : SiteSpatialGrid::kInvalidSlot;
+}
+
+void DynamicBondManager::refreshGridSite(const BondableEntity& entity, uint32_t siteId)
+{
+    uint32_t slot = getGridSlot(entity, siteId);
+    if (slot != SiteSpatialGrid::kInvalidSlot)
+    {
+        m_siteGrid.setSiteActive(slot, entity.canBondAt(siteId));
+    }
+}
+
+void DynamicBondManager::untrackEntity(BondableEntity& entity)
+{
+    m_siteTransforms.removeEntity(entity);
+    invalidateCandidatePairs();
+
+    auto trackingIt = m_entityTracking.find(entity.getEntityId());
+    if (trackingIt == m_entityTracking.end())
+        return;
+
+    for (uint32_t slot : trackingIt->second.gridSlots)
+    {
+        m_siteGrid.removeSite(slot);
+        m_gridSites[slot] = GridSite();
+    }
+    m_entityTracking.erase(trackingIt);
+}
+
+float DynamicBondManager::getCandidateSearchRadius() const
+{
+    float radius = m_config.captureDistance;
+    for (const auto& rule : m_rules)
+    {
+        if (const auto* proximityRule = dynamic_cast<const ProximityRule*>(rule.get()))
+        {
+            radius = std::max(radius, proximityRule->getCaptureDistance());
+        }
+    }
+
+    // Slack so that pairs on the boundary are left to the proximity rule to decide
+    return radius * 1.001f;
+}
+
+bool DynamicBondManager::isGridPairBondable(const GridSite& a, const GridSite& b, bool filterSiteTypes)
+{
+    if (a.entity == b.entity)
+        return false;
+
+    // With the type rule active, incompatible pairs are dropped before scoring
+    return !filterSiteTypes || !a.typeMask.isInterned() || !b.typeMask.isInterned() ||
+           areSiteTypesCompatible(a.typeMask, b.typeMask);
+}
+
+float DynamicBondManager::getProximitySkin() const
+{
+    const bool useSkin = m_config.adaptiveProximityChecks || m_config.useVerletLists;
+    return useSkin ? std::max(0.0f, m_config.proximitySkin) : 0.0f;
 }
 
 std::vector<DynamicBondManager::BondCandidate> DynamicBondManager::findBondCandidates()
 {
-    std::vector<BondCandidate> candidates;
+    // Work is split into tasks that each fill their own scratch; merging the
+    // scratch lists in task order keeps the result independent of thread timing
+    size_t taskCount = 1;
 
-    if (m_config.enableSpatialHashing)
+    // Pairs between the capture range and capture range + skin are not scored;
+    // the closest one tells the adaptive scheduler how far sites may move
+    const float captureRadius = getCandidateSearchRadius();
+    const float skin = m_config.enableSpatialHashing ? getProximitySkin() : 0.0f;
+    const bool useVerletPairs = m_config.enableSpatialHashing && m_config.useVerletLists;
+
+    if (useVerletPairs)
     {
-        // Use spatial hash for efficient lookup
-        for (const auto& [cellKey, cell] : m_spatialHash)
+        // Score the stored pairs whose sites are still available and in range
+        const physx::PxVec3* positions = m_siteTransforms.getPositions();
+        const size_t pairTotal = m_verletPairs.size();
+        taskCount = std::max<size_t>(1, std::min(getTaskCount(), pairTotal));
+        m_scoringScratch.resize(std::max(m_scoringScratch.size(), taskCount));
+
+        runTasks(taskCount, [&](size_t task)
         {
-            // Get neighboring cells
-            physx::PxVec3 cellCenter; // Approximate center
-            auto neighborKeys = getNeighborCells(cellCenter);
+            ScoringScratch& scratch = m_scoringScratch[task];
 
-            // Check pairs within this cell and neighbors
-            for (size_t i = 0; i < cell.sites.size(); ++i)
+            for (size_t i = pairTotal * task / taskCount; i < pairTotal * (task + 1) / taskCount; ++i)
             {
-                const auto& [entityId1, siteId1] = cell.sites[i];
-                const BondableEntity* e1 = getEntity(entityId1);
-                if (!e1)
+                const VerletPair& pair = m_verletPairs[i];
+                if (!pair.entity1->canBondAt(pair.site1Id) || !pair.entity2->canBondAt(pair.site2Id))
                     continue;
 
-                // Same cell pairs
-                for (size_t j = i + 1; j < cell.sites.size(); ++j)
+                const float distance = (positions[pair.position2] - positions[pair.position1]).magnitude();
+                if (distance > captureRadius)
                 {
-                    const auto& [entityId2, siteId2] = cell.sites[j];
-                    const BondableEntity* e2 = getEntity(entityId2);
-                    if (!e2)
-                        continue;
-
-                    float score = evaluateRules(*e1, siteId1, *e2, siteId2);
-                    if (score > 0)
-                    {
-                        candidates.push_back({entityId1, entityId2, siteId1, siteId2, score});
-                    }
+                    scratch.nearestOutside = std::min(scratch.nearestOutside, distance);
+                    continue;
                 }
 
-                // Neighbor cell pairs
-                for (int64_t neighborKey : neighborKeys)
-                {
-                    if (neighborKey <= cellKey)
-                        continue; // Avoid duplicates
+                addCandidatePair(scratch, *pair.entity1, pair.site1Id, *pair.entity2, pair.site2Id);
+            }
 
-                    auto neighborIt = m_spatialHash.find(neighborKey);
-                    if (neighborIt == m_spatialHash.end())
-                        continue;
+            scoreCandidateBatch(scratch);
+        });
+    }
+    else if (m_config.enableSpatialHashing)
+    {
+        const float searchRadius = std::min(captureRadius + skin, m_siteGrid.getCellSize());
+        const size_t cellCount = m_siteGrid.getCellCount();
+        const bool filterSiteTypes = hasRule<TypeCompatibilityRule>();
 
-                    for (const auto& [entityId2, siteId2] : neighborIt->second.sites)
-                    {
-                        const BondableEntity* e2 = getEntity(entityId2);
-                        if (!e2)
-                            continue;
+        taskCount = std::max<size_t>(1, std::min(getTaskCount(), cellCount));
+        m_scoringScratch.resize(std::max(m_scoringScratch.size(), taskCount));
 
-                        float score = evaluateRules(*e1, siteId1, *e2, siteId2);
-                        if (score > 0)
-                        {
-                            candidates.push_back({entityId1, entityId2, siteId1, siteId2, score});
-                        }
+        runTasks(taskCount, [&](size_t task)
+        {
+            ScoringScratch& scratch = m_scoringScratch[task];
+
+            m_siteGrid.forEachPairInCells(
+                cellCount * task / taskCount, cellCount * (task + 1) / taskCount, searchRadius,
+                [&](uint32_t a, uint32_t b)
+            {
+                const GridSite* first = &m_gridSites[a];
+                const GridSite* second = &m_gridSites[b];
+
+                if (!isGridPairBondable(*first, *second, filterSiteTypes))
+                    return;
+
+                if (skin > 0.0f)
+                {
+                    const float distance = (m_siteGrid.getSitePosition(a) - m_siteGrid.getSitePosition(b)).magnitude();
+                    if (distance > captureRadius)
+                    {
+                        scratch.nearestOutside = std::min(scratch.nearestOutside, distance);
+                        return;
                     }
                 }
-            }
-        }
+
+                // Same argument order as the brute force path: lower entity ID first
+                if (first->entity->getEntityId() > second->entity->getEntityId())
+                    std::swap(first, second);
+
+                addCandidatePair(scratch, *first->entity, first->siteId, *second->entity, second->siteId);
+            });
+
+            scoreCandidateBatch(scratch);
+        });
     }
     else
     {
         // Brute force all pairs
-        std::vector<uint64_t> entityIds;
-        for (const auto& [id, entity] : m_entities)
-        {
-            entityIds.push_back(id);
-        }
+        std::vector<uint64_t> entityIds = getEntityIds();
+        std::sort(entityIds.begin(), entityIds.end());
 
+        // Available sites per entity, gathered once instead of per pair
+        std::vector<std::vector<uint32_t>> availableSites(entityIds.size());
         for (size_t i = 0; i < entityIds.size(); ++i)
         {
-            const BondableEntity* e1 = getEntity(entityIds[i]);
-            if (!e1)
-                continue;
+            availableSites[i] = getEntity(entityIds[i])->getAvailableSites();
+        }
 
-            auto sites1 = e1->getAvailableSites();
-            if (sites1.empty())
-                continue;
+        const size_t entityCount = entityIds.size();
+        taskCount = std::max<size_t>(1, std::min(getTaskCount(), entityCount));
+        m_scoringScratch.resize(std::max(m_scoringScratch.size(), taskCount));
 
-            for (size_t j = i + 1; j < entityIds.size(); ++j)
-            {
-                const BondableEntity* e2 = getEntity(entityIds[j]);
-                if (!e2)
-                    continue;
+        runTasks(taskCount, [&](size_t task)
+        {
+            ScoringScratch& scratch = m_scoringScratch[task];
 
-                auto sites2 = e2->getAvailableSites();
-                if (sites2.empty())
+            for (size_t i = entityCount * task / taskCount; i < entityCount * (task + 1) / taskCount; ++i)
+            {
+                const BondableEntity* e1 = getEntity(entityIds[i]);
+                const auto& sites1 = availableSites[i];
+                if (sites1.empty())
                     continue;
 
-                // Check all site pairs
-                for (uint32_t s1 : sites1)
+                for (size_t j = i + 1; j < entityCount; ++j)
                 {
-                    for (uint32_t s2 : sites2)
+                    const BondableEntity* e2 = getEntity(entityIds[j]);
+                    const auto& sites2 = availableSites[j];
+                    if (sites2.empty())
+                        continue;
+
+                    // Check all site pairs
+                    for (uint32_t s1 : sites1)
                     {
-                        float score = evaluateRules(*e1, s1, *e2, s2);
-                        if (score > 0)
+                        for (uint32_t s2 : sites2)
                         {
-                            candidates.push_back({entityIds[i], entityIds[j], s1, s2, score});
+                            addCandidatePair(scratch, *e1, s1, *e2, s2);
                         }
                     }
                 }
             }
+
+            scoreCandidateBatch(scratch);
+        });
+    }
+
+    // Merge in task order
+    size_t total = 0;
+    size_t pairCount = 0;
+    float nearestOutside = PX_MAX_F32;
+    for (size_t task = 0; task < taskCount; ++task)
+    {
+        ScoringScratch& scratch = m_scoringScratch[task];
+        total += scratch.candidates.size();
+        pairCount += scratch.pairCount;
+        nearestOutside = std::min(nearestOutside, scratch.nearestOutside);
+        scratch.pairCount = 0;
+        scratch.nearestOutside = PX_MAX_F32;
+    }
+
+    // Record what this search saw; changes from here on (including the bonds
+    // formed from its candidates) are measured against it
+    if (m_config.adaptiveProximityChecks)
+    {
+        m_candidateSearchNeeded = false;
+        m_sitesMovedSinceSearch = false;
+        m_maxSiteDisplacement = 0.0f;
+        m_searchFoundPairs = pairCount > 0;
+
+        // Pairs not seen were beyond capture range + skin (when a stored list
+        // was used, when it was built)
+        float unseenDistance = captureRadius + skin;
+        if (useVerletPairs)
+        {
+            unseenDistance -= 2.0f * m_maxVerletDisplacement;
         }
+        m_searchClearance = std::min(nearestOutside, unseenDistance) - captureRadius;
+
+        const physx::PxVec3* positions = m_siteTransforms.getPositions();
+        m_searchPositions.assign(positions, positions + m_siteTransforms.getSiteSlotCount());
+    }
+
+    std::vector<BondCandidate> candidates;
+    candidates.reserve(total);
+    for (size_t task = 0; task < taskCount; ++task)
+    {
+        auto& taskCandidates = m_scoringScratch[task].candidates;
+        candidates.insert(candidates.end(), taskCandidates.begin(), taskCandidates.end());
+        taskCandidates.clear();
     }
 
     return candidates;
 }
 
-float DynamicBondManager::evaluateRules(
+bool DynamicBondManager::isBetterCandidate(const BondCandidate& a, const BondCandidate& b)
+{
+    // Score descending; ties broken by IDs so the order does not depend on
+    // the order pairs were discovered in
+    if (a.score != b.score)
+        return a.score > b.score;
+    if (a.entity1Id != b.entity1Id)
+        return a.entity1Id < b.entity1Id;
+    if (a.site1Id != b.site1Id)
+        return a.site1Id < b.site1Id;
+    if (a.entity2Id != b.entity2Id)
+        return a.entity2Id < b.entity2Id;
+    return a.site2Id < b.site2Id;
+}
+
+void DynamicBondManager::commitCandidates(std::vector<BondCandidate>& candidates)
+{
+    if (m_config.maxBondsPerFrame == 0)
+        return;
+
+    // Greedy matching in score order. Only a window of the best remaining
+    // candidates is sorted at a time; the next window is selected only if
+    // conflicts rejected enough of the current one that the per-frame cap
+    // has not been reached. The bonds formed are the same as with a full sort.
+    const size_t windowSize = std::max<size_t>(32, static_cast<size_t>(m_config.maxBondsPerFrame) * 4);
+
+    auto windowBegin = candidates.begin();
+    while (windowBegin != candidates.end() && m_bondsFormedThisFrame < m_config.maxBondsPerFrame)
+    {
+        auto windowEnd = candidates.end();
+        if (static_cast<size_t>(windowEnd - windowBegin) > windowSize)
+        {
+            windowEnd = windowBegin + windowSize;
+            std::nth_element(windowBegin, windowEnd, candidates.end(), isBetterCandidate);
+        }
+        std::sort(windowBegin, windowEnd, isBetterCandidate);
+
+        for (auto it = windowBegin; it != windowEnd && m_bondsFormedThisFrame < m_config.maxBondsPerFrame; ++it)
+        {
+            const BondCandidate& candidate = *it;
+
+            BondableEntity* e1 = getEntity(candidate.entity1Id);
+            BondableEntity* e2 = getEntity(candidate.entity2Id);
+
+            if (!e1 || !e2)
+                continue;
+
+            // Verify sites are still available (might have been taken by earlier bonds)
+            if (!e1->canBondAt(candidate.site1Id) || !e2->canBondAt(candidate.site2Id))
+                continue;
+
+            createBondInternal(
+                *e1, candidate.site1Id,
+                *e2, candidate.site2Id,
+                m_config.defaultBondType,
+                m_config.defaultBondConfig,
+                true);
+        }
+
+        windowBegin = windowEnd;
+    }
+}
+
+void DynamicBondManager::addCandidatePair(
+    ScoringScratch& scratch,
     const BondableEntity& e1, uint32_t s1,
     const BondableEntity& e2, uint32_t s2) const
 {
-    float combinedScore = 1.0f;
+    scratch.batch.add(
+        &e1, s1, e1.getSiteWorldPosition(s1), e1.getSiteWorldDirection(s1),
+        &e2, s2, e2.getSiteWorldPosition(s2), e2.getSiteWorldDirection(s2));
+    scratch.pairCount++;
+
+    if (scratch.batch.size() >= kCandidateBatchSize)
+    {
+        scoreCandidateBatch(scratch);
+    }
+}
+
+void DynamicBondManager::scoreCandidateBatch(ScoringScratch& scratch) const
+{
+    BondCandidateBatch& batch = scratch.batch;
 
+    // Rules run in priority order over whatever the previous rules let through
     for (const auto& rule : m_rules)
     {
-        float score = rule->evaluate(e1, s1, e2, s2);
+        if (batch.empty())
+            break;
 
-        if (score < 0.0f)
-            return -1.0f; // Veto
+        scratch.ruleScores.resize(batch.size());
+        rule->evaluateBatch(batch, scratch.ruleScores.data());
+        batch.applyRuleScores(scratch.ruleScores.data());
+    }
+
+    for (size_t i = 0; i < batch.size(); ++i)
+    {
+        if (batch.score[i] > 0)
+        {
+            scratch.candidates.push_back({
+                batch.entity1[i]->getEntityId(), batch.entity2[i]->getEntityId(),
+                batch.site1[i], batch.site2[i],
+                batch.score[i]});
+        }
+    }
+
+    batch.clear();
+}
+
+void DynamicBondManager::runTasks(size_t taskCount, const std::function<void(size_t)>& fn)
+{
+    if (m_workerPool)
+    {
+        m_workerPool->parallelFor(taskCount, fn);
+        return;
+    }
 
-        if (score > 0.0f)
-            combinedScore *= score;
+    for (size_t task = 0; task < taskCount; ++task)
+    {
+        fn(task);
     }
+}
 
-    return combinedScore;
+size_t DynamicBondManager::getTaskCount() const
+{
+    // A few tasks per thread so uneven cells or entity ranges still balance
+    return m_workerPool ? m_workerPool->getThreadCount() * 4 : 1;
 }
 
 uint64_t DynamicBondManager::createBondInternal(
     BondableEntity& e1, uint32_t s1,
     BondableEntity& e2, uint32_t s2,
     const std::string& bondTypeName,
-    const BondConfig& config)
+    const BondConfig& config,
+    bool countAsFormed)
 {
     // Get bond type
-    IBondType* bondType = getBondType(bondTypeName);
-    if (!bondType)
+    BondTypeId typeId = getBondTypeId(bondTypeName);
+    if (typeId == kInvalidBondType)
     {
-        bondType = getBondType(m_config.defaultBondType);
-        if (!bondType)
+        typeId = getBondTypeId(m_config.defaultBondType);
+        if (typeId == kInvalidBondType)
             return 0;
     }
+    IBondType* bondType = m_bondTypes[typeId].get();
+    if (!bondType)
+        return 0;
 
     // Get actors
     physx::PxRigidActor* actor1 = e1.getActor();
@@ -788,35 +1661,52 @@ uint64_t DynamicBondManager::createBondInternal(
     if (!site1 || !site2)
         return 0;
 
-    physx::PxTransform frame1(site1->getLocalPosition());
-    physx::PxTransform frame2(site2->getLocalPosition());
-
-    // Create bond ID
-    uint64_t bondId = m_nextBondId.fetch_add(1);
+    // Sites have fixed bond storage; never exceed their valency
+    if (!e1.canBondAt(s1) || !e2.canBondAt(s2))
+        return 0;
 
-    // Create bond structure
+    // Create bond structure; the store assigns the ID
     Bond bond;
-    bond.bondId = bondId;
     bond.endpoint1 = {e1.getEntityId(), s1};
     bond.endpoint2 = {e2.getEntityId(), s2};
-    bond.bondType = bondTypeName;
+    bond.typeId = typeId;
     bond.formationTime = m_simulationTime;
 
-    // Create PhysX joint
-    bond.joint = bondType->createJoint(m_physics, actor1, frame1, actor2, frame2, bond, config);
+    uint64_t bondId = m_bonds.insert(bond);
+    bond.bondId = bondId;
 
-    if (!bond.joint)
-        return 0;
+    // The joint is created when the command buffer is applied
+    BondCommandBuffer::Formation formation;
+    formation.bondId = bondId;
+    formation.bondType = bondType;
+    formation.actor1 = actor1;
+    formation.actor2 = actor2;
+    formation.frame1 = physx::PxTransform(site1->getLocalPosition());
+    formation.frame2 = physx::PxTransform(site2->getLocalPosition());
+    formation.config = config;
+    formation.formedIndex = m_commands.formed.size();
+    formation.countedAsFormed = countAsFormed;
+    m_commands.formations.push_back(formation);
+    m_commands.formed.push_back(bond);
+
+    if (countAsFormed)
+    {
+        m_bondsFormedThisFrame++;
+    }
 
     // Record bond in entities
     e1.recordBond(s1, bondId);
     e2.recordBond(s2, bondId);
+    m_candidateSearchNeeded = true;
 
-    // Store bond
-    m_bonds[bondId] = bond;
+    // Saturated sites leave the grid immediately
+    refreshGridSite(e1, s1);
+    refreshGridSite(e2, s2);
 
-    // Fire callback
-    fireBondFormed(bond);
+    // Update bond topology
+    m_ringDetector.onBondFormed(bond, m_simulationTime);
+    m_bondGraph.addEdge(bond);
+    m_clusterTracker.addEdge(bond);
 
     return bondId;
 }
@@ -1,10 +1,22 @@
 #pragma once
 
+#include "ActorResourceCache.h"
 #include "BondableEntity.h"
 #include "BondableEntityDef.h"
 #include "Bond.h"
+#include "BondBreakListener.h"
+#include "BondCommandBuffer.h"
+#include "BondGraph.h"
+#include "BondStore.h"
+#include "ClusterTracker.h"
+#include "EntityTemplate.h"
+#include "JointPool.h"
+#include "RingDetector.h"
 #include "IBondFormationRule.h"
 #include "IBondType.h"
+#include "SiteSpatialGrid.h"
+#include "SiteTransformCache.h"
+#include "WorkerPool.h"
 #include <PxPhysicsAPI.h>
 #include <unordered_map>
 #include <unordered_set>
@@ -26,13 +38,36 @@ struct DynamicBondManagerConfig
     /// Default capture distance for proximity checks
     float captureDistance = 2.0f;
 
+    /// Skip proximity checks that cannot find anything new
+    /// A check is skipped when no bond, entity, rule or setting changed since
+    /// the last candidate search and either no actor with an available site
+    /// has been awake since, or (with spatial hashing) the last search found no
+    /// pair in range and no site has moved far enough to bring one into range.
+    /// Call requestProximityCheck() after changing other state rules read,
+    /// such as entity properties.
+    bool adaptiveProximityChecks = false;
+
+    /// Keep the site pairs found by the grid and reuse them between checks
+    /// (spatial hashing only). The grid collects every pair within the capture
+    /// range plus proximitySkin; later checks score only those pairs until a
+    /// site with an available neighbour has moved half the skin, or sites,
+    /// entities, rules or settings change.
+    bool useVerletLists = false;
+
+    /// Distance added to the capture range by the adaptive scheduler and by
+    /// the pair lists (spatial hashing only). The adaptive scheduler uses it
+    /// to find the nearest pair outside capture range; sites may move half of
+    /// the remaining gap before the next search is needed.
+    float proximitySkin = 0.5f;
+
     /// Maximum number of bonds to form per frame (for performance)
     uint32_t maxBondsPerFrame = 10;
 
     /// Enable spatial hashing for faster proximity checks
     bool enableSpatialHashing = true;
 
-    /// Cell size for spatial hashing (should be >= captureDistance)
+    /// Cell size for spatial hashing
+    /// Raised automatically to the largest proximity capture distance if smaller
     float spatialCellSize = 5.0f;
 
     /// Default bond configuration
@@ -40,6 +75,28 @@ struct DynamicBondManagerConfig
 
     /// Default bond type name
     std::string defaultBondType = "rigid";
+
+    /// Threads used for candidate search and scoring (1 = calling thread only,
+    /// 0 = hardware concurrency). Bonds are always created on the calling thread.
+    /// With more than one thread, rules are evaluated concurrently.
+    uint32_t workerThreads = 1;
+
+    /// Detect broken bonds from the scene's constraint-break events instead of
+    /// polling every joint each frame. The manager installs its own scene event
+    /// callback and forwards all events to the one previously set. If the
+    /// callback is replaced later, the manager polls until it can reinstall.
+    bool useBreakEvents = true;
+
+    /// Largest ring measured exactly when a bond closes one; larger rings are
+    /// still detected but reported with size 0. Raised by requireRingSize().
+    uint32_t maxRingSize = 32;
+
+    /// Released joints kept per bond type for reuse (0 = no pooling)
+    /// A pooled joint stays in the scene disabled and is rebound when a bond of
+    /// its type forms, instead of releasing one joint and creating another.
+    /// Only joints of bonds removed on purpose are pooled; joints broken by
+    /// force are always released.
+    uint32_t jointPoolSize = 0;
 };
 
 /// Statistics about the bond manager state
@@ -51,12 +108,14 @@ struct BondManagerStats
     size_t saturatedEntityCount = 0;
     size_t bondsFormedThisFrame = 0;
     size_t bondsBrokenThisFrame = 0;
+    size_t skippedProximityChecks = 0;  ///< Checks skipped by adaptiveProximityChecks
     float lastUpdateTime = 0.0f;
 };
 
 /// Callback types
 using BondFormedCallback = std::function<void(const BondFormedEvent&)>;
 using BondBrokenCallback = std::function<void(const BondBrokenEvent&)>;
+using BondEventBatchCallback = std::function<void(const BondEventBatch&)>;
 
 /// Manages dynamic bond formation and breaking in a simulation
 /// Central component that coordinates entities, bonds, rules, and bond types
@@ -81,12 +140,66 @@ public:
 
     // --- Entity Management ---
 
+    /// Register a shared template for an entity type (keyed by def.entityType)
+    /// Replaces an earlier template of the same type; entities already built
+    /// from it keep the old one.
+    EntityTemplatePtr registerEntityTemplate(const BondableEntityDef& def);
+
+    /// Get the template registered for an entity type, or nullptr
+    EntityTemplatePtr getEntityTemplate(const std::string& entityType) const;
+
+    /// Property schema used for the typed columns of templates
+    /// Declare the properties rules read before registering entities; a key
+    /// declared later is looked up by name on templates built before it.
+    PropertySchema& getPropertySchema() { return m_propertySchema; }
+    const PropertySchema& getPropertySchema() const { return m_propertySchema; }
+
     /// Register a new bondable entity
+    /// The definition is copied into a template used only by this entity;
+    /// prefer the template overload for many entities of one type.
     /// @param def Entity definition
     /// @param existingActor Optional existing actor (if nullptr, creates new)
     /// @return Assigned entity ID
     uint64_t registerEntity(const BondableEntityDef& def, physx::PxRigidActor* existingActor = nullptr);
 
+    /// Register a new bondable entity sharing a template
+    /// A template not built against this manager's site types and property
+    /// schema (e.g. by another manager) is rebuilt from its definition first,
+    /// so the entity does not share it.
+    /// @param entityTemplate Template (e.g. from registerEntityTemplate())
+    /// @param placement Initial pose and velocity of the new actor
+    /// @param existingActor Optional existing actor (if nullptr, creates new)
+    /// @return Assigned entity ID
+    uint64_t registerEntity(
+        const EntityTemplatePtr& entityTemplate,
+        const EntityPlacement& placement,
+        physx::PxRigidActor* existingActor = nullptr);
+
+    /// Register many new bondable entities at once
+    /// Storage is reserved for the whole batch and actors are added to the
+    /// scene with a single addActors() call.
+    /// @param defs Entity definitions
+    /// @param count Number of definitions
+    /// @return Assigned entity IDs in definition order (0 where the actor could not be created)
+    std::vector<uint64_t> registerEntities(const BondableEntityDef* defs, size_t count);
+
+    std::vector<uint64_t> registerEntities(const std::vector<BondableEntityDef>& defs)
+    {
+        return registerEntities(defs.data(), defs.size());
+    }
+
+    /// Register many new bondable entities sharing one template
+    /// A template not built by this manager is rebuilt once for the batch.
+    /// @return Assigned entity IDs in placement order (0 where the actor could not be created)
+    std::vector<uint64_t> registerEntities(
+        const EntityTemplatePtr& entityTemplate, const EntityPlacement* placements, size_t count);
+
+    std::vector<uint64_t> registerEntities(
+        const EntityTemplatePtr& entityTemplate, const std::vector<EntityPlacement>& placements)
+    {
+        return registerEntities(entityTemplate, placements.data(), placements.size());
+    }
+
     /// Unregister an entity and break all its bonds
     void unregisterEntity(uint64_t entityId);
 
@@ -100,6 +213,9 @@ public:
     /// Get entity count
     size_t getEntityCount() const { return m_entities.size(); }
 
+    /// Materials and shapes shared by entity actors
+    const ActorResourceCache& getActorResources() const { return m_actorResources; }
+
     // --- Rule Management ---
 
     /// Add a bond formation rule
@@ -123,12 +239,23 @@ public:
     IBondType* getBondType(const std::string& name);
     const IBondType* getBondType(const std::string& name) const;
 
+    /// Get a bond type by interned ID
+    const IBondType* getBondType(BondTypeId typeId) const;
+
+    /// Interned ID of a registered bond type, or kInvalidBondType
+    BondTypeId getBondTypeId(const std::string& name) const;
+
+    /// Name of an interned bond type (empty if unknown)
+    const std::string& getBondTypeName(BondTypeId typeId) const;
+
     /// Set default bond type
     void setDefaultBondType(const std::string& name);
 
     // --- Bond Operations ---
 
     /// Manually create a bond between two sites
+    /// Called from inside update() (e.g. from a callback), the joint is created
+    /// with the rest of that update's bonds at its end.
     /// @return Bond ID, or 0 on failure
     uint64_t createBond(
         uint64_t entity1Id, uint32_t site1Id,
@@ -140,23 +267,40 @@ public:
     void breakBond(uint64_t bondId);
 
     /// Get all bonds
-    const std::unordered_map<uint64_t, Bond>& getBonds() const { return m_bonds; }
+    const BondStore& getBonds() const { return m_bonds; }
 
     /// Get bond count
     size_t getBondCount() const { return m_bonds.size(); }
 
-    /// Get a bond by ID
-    const Bond* getBond(uint64_t bondId) const;
+    /// Get a bond by ID (nullptr once the bond is gone)
+    const Bond* getBond(uint64_t bondId) const { return m_bonds.find(bondId); }
 
     /// Get bonds involving a specific entity
     std::vector<const Bond*> getBondsForEntity(uint64_t entityId) const;
 
+    /// Entity adjacency of the current bonds, updated as bonds form and break
+    const BondGraph& getBondGraph() const { return m_bondGraph; }
+
+    /// Connected clusters of the current bonds
+    const ClusterTracker& getClusterTracker() const { return m_clusterTracker; }
+
+    /// Rings in the current bond graph
+    const RingDetector& getRingDetector() const { return m_ringDetector; }
+
+    /// Measure rings up to this size exactly even if maxRingSize is smaller
+    /// (used by metrics and conditions that look for a ring size)
+    void requireRingSize(uint32_t ringSize) { m_ringDetector.requireRingSize(ringSize); }
+
     // --- Simulation Update ---
 
     /// Update the bond manager (call every frame)
     /// @param dt Time step in seconds
     void update(float dt);
 
+    /// Run the candidate search at the next proximity check even if the
+    /// adaptive scheduler would skip it
+    void requestProximityCheck() { m_candidateSearchNeeded = true; }
+
     /// Get current simulation time
     float getSimulationTime() const { return m_simulationTime; }
 
@@ -171,6 +315,10 @@ public:
     /// Register a callback for bond breaking
     void onBondBroken(BondBrokenCallback callback);
 
+    /// Register a callback receiving all bond events of an update at once
+    /// Called after the per-bond callbacks, only when something changed.
+    void onBondEvents(BondEventBatchCallback callback);
+
     /// Clear all callbacks
     void clearCallbacks();
 
@@ -198,18 +346,35 @@ private:
     // Entity management
     std::unordered_map<uint64_t, std::unique_ptr<BondableEntity>> m_entities;
     std::atomic<uint64_t> m_nextEntityId{1};
+    ActorResourceCache m_actorResources;
+    std::unordered_map<std::string, EntityTemplatePtr> m_entityTemplates;
+    SiteTypeRegistry m_siteTypes;
+    PropertySchema m_propertySchema;
 
     // Bond management
-    std::unordered_map<uint64_t, Bond> m_bonds;
-    std::atomic<uint64_t> m_nextBondId{1};
+    BondStore m_bonds;
+    std::unordered_map<const physx::PxJoint*, uint64_t> m_jointBonds;  ///< Joint -> bond ID
+    BondGraph m_bondGraph;
+    ClusterTracker m_clusterTracker{m_bondGraph};
+    RingDetector m_ringDetector{m_bondGraph, m_clusterTracker};
 
     // Rules and bond types
     std::vector<BondFormationRulePtr> m_rules;
-    std::unordered_map<std::string, BondTypePtr> m_bondTypes;
+    std::vector<BondTypePtr> m_bondTypes;                   ///< Indexed by BondTypeId
+    std::vector<std::string> m_bondTypeNames;               ///< Indexed by BondTypeId
+    std::unordered_map<std::string, BondTypeId> m_bondTypeIds;
+    std::vector<JointPool> m_jointPools;                    ///< Indexed by BondTypeId
 
     // Callbacks
     std::vector<BondFormedCallback> m_bondFormedCallbacks;
     std::vector<BondBrokenCallback> m_bondBrokenCallbacks;
+    std::vector<BondEventBatchCallback> m_bondEventCallbacks;
+
+    // Joint creation/release and callbacks waiting for the end of the update
+    BondCommandBuffer m_commands;
+    BondCommandBuffer m_applyingCommands;
+    bool m_updating = false;
+    bool m_applyingBondCommands = false;
 
     // Simulation state
     float m_simulationTime = 0.0f;
@@ -219,50 +384,226 @@ private:
     size_t m_bondsFormedThisFrame = 0;
     size_t m_bondsBrokenThisFrame = 0;
 
-    // Spatial hashing
-    struct SpatialCell
+    // Adaptive proximity checks: what happened since the last candidate search
+    bool m_candidateSearchNeeded = true;        ///< A bond, entity, rule or setting changed
+    bool m_sitesMovedSinceSearch = false;       ///< An entity with available sites was refreshed
+    float m_maxSiteDisplacement = 0.0f;         ///< Largest move of one of its sites
+    bool m_searchFoundPairs = false;            ///< The search had pairs in range
+    float m_searchClearance = 0.0f;             ///< Gap between capture range and the nearest pair outside
+    std::vector<physx::PxVec3> m_searchPositions;   ///< Site positions at the search, by cache index
+    size_t m_skippedProximityChecks = 0;
+
+    // Verlet pair list: pairs within capture range + skin when it was built
+    struct VerletPair
     {
-        std::vector<std::pair<uint64_t, uint32_t>> sites; // entityId, siteId
+        const BondableEntity* entity1 = nullptr;    ///< Lower entity ID
+        const BondableEntity* entity2 = nullptr;
+        uint32_t site1Id = 0, site2Id = 0;
+        uint32_t position1 = 0, position2 = 0;      ///< Site transform cache indices
     };
-    std::unordered_map<int64_t, SpatialCell> m_spatialHash;
+    std::vector<VerletPair> m_verletPairs;
+    bool m_verletPairsStale = true;             ///< Sites, entities, rules or settings changed
+    float m_maxVerletDisplacement = 0.0f;       ///< Largest move of a site with available sites since the build
+    std::vector<physx::PxVec3> m_verletPositions;   ///< Site positions at the build, by cache index
 
-    // --- Internal methods ---
+    /// Largest displacements found by one refresh task
+    struct TaskDisplacement
+    {
+        float sinceSearch = 0.0f;
+        float sinceVerletBuild = 0.0f;
+    };
+    std::vector<TaskDisplacement> m_taskDisplacements;
 
-    /// Create PhysX actor from definition
-    physx::PxRigidActor* createActor(const ActorDef& def);
+    // Per-entity state for the incremental proximity structures
+    struct EntityTracking
+    {
+        std::vector<uint32_t> gridSlots;  ///< In getAllSites() order; empty until added to the grid
+        bool awake = true;                ///< Actor was dynamic and awake at the last check
+        bool moved = true;                ///< Transforms were refreshed since the grid last saw them
+    };
+    std::unordered_map<uint64_t, EntityTracking> m_entityTracking;
 
-    /// Check for broken joints and remove them
-    void checkBrokenBonds();
+    // World-space site transforms, refreshed for moving entities each check
+    SiteTransformCache m_siteTransforms;
 
-    /// Update spatial hash with current site positions
-    void updateSpatialHash();
-
-    /// Get spatial hash key from position
-    int64_t getSpatialKey(const physx::PxVec3& pos) const;
+    // Spatial hashing: persistent grid over all sites; saturated sites are inactive
+    struct GridSite
+    {
+        BondableEntity* entity = nullptr;
+        uint32_t siteId = 0;
+        SiteTypeMask typeMask;      ///< Copied from the template for the pair filter
+    };
+    SiteSpatialGrid m_siteGrid;
+    std::vector<GridSite> m_gridSites;  ///< Indexed by grid slot
 
-    /// Get neighboring cells for a position
-    std::vector<int64_t> getNeighborCells(const physx::PxVec3& pos) const;
+    // Candidate scoring: pairs are scored in batches of this size
+    static constexpr size_t kCandidateBatchSize = 4096;
 
-    /// Find potential bond candidates
+    /// Scratch for one scoring task; tasks write only to their own scratch
     struct BondCandidate
     {
         uint64_t entity1Id, entity2Id;
         uint32_t site1Id, site2Id;
         float score;
     };
+    struct ScoringScratch
+    {
+        BondCandidateBatch batch;
+        std::vector<float> ruleScores;
+        std::vector<BondCandidate> candidates;
+        std::vector<VerletPair> verletPairs;
+        size_t pairCount = 0;                   ///< Pairs in capture range
+        float nearestOutside = PX_MAX_F32;      ///< Closest pair beyond it, within the skin
+    };
+    std::vector<ScoringScratch> m_scoringScratch;
+
+    // Threads for candidate search; null when running single-threaded
+    std::unique_ptr<WorkerPool> m_workerPool;
+    std::vector<BondableEntity*> m_refreshEntities;
+
+    // Constraint-break events from the scene
+    BondBreakListener m_breakListener;
+    bool m_breakListenerAttached = false;
+    std::vector<physx::PxJoint*> m_brokenJoints;
+
+    // --- Internal methods ---
+
+    /// Create PhysX actor from definition at a placement
+    physx::PxRigidActor* createActor(const ActorDef& def, const EntityPlacement& placement);
+
+    /// Intern the site types of a definition (before building its template)
+    void internSiteTypes(const BondableEntityDef& def);
+
+    /// The template itself if it was built against this manager's registries,
+    /// otherwise a copy rebuilt from its definition
+    EntityTemplatePtr adoptTemplate(const EntityTemplatePtr& entityTemplate);
+
+    /// Create actors and entities for a batch (templates and placements are parallel arrays)
+    std::vector<uint64_t> registerEntityBatch(
+        const EntityTemplatePtr* templates, const EntityPlacement* placements, size_t count);
+
+    /// Check every joint for breaks and remove broken bonds (polling fallback)
+    void checkBrokenBonds();
+
+    /// Remove the bonds whose joints were reported broken since the last frame
+    void processBreakEvents();
+
+    /// Remove a bond whose joint broke under load
+    void removeBrokenBond(uint64_t bondId);
+
+    /// Remove a bond from entity records, grid, graph and clusters (not the store)
+    void detachBond(const Bond& bond);
+
+    /// Queue a removed bond's joint release and broken callbacks
+    void queueBondBroken(const Bond& bond, bool wasBreakForce);
+
+    /// Create and release the queued joints, then fire the queued callbacks
+    void applyBondCommands();
+
+    /// Release queued joints right away (before their actors go)
+    void releaseQueuedJoints();
+
+    /// Joint for a queued formation, reused from the type's pool when possible
+    physx::PxJoint* acquireJoint(const BondCommandBuffer::Formation& formation, const Bond& bond);
+
+    /// Park a joint in its type's pool, or release it if it cannot be pooled
+    void retireJoint(const BondCommandBuffer::Release& release);
+
+    /// Make sure the break listener is the scene's event callback
+    /// @return True if it was already installed, so no events were missed
+    bool attachBreakListener();
+
+    /// Restore the scene's previous event callback
+    void detachBreakListener();
+
+    /// Capture site transforms of new entities and of entities that may have moved
+    void refreshSiteTransforms();
+
+    /// Update spatial hash with current site positions
+    void updateSpatialHash();
+
+    /// Largest distance at which any proximity rule can accept a pair
+    float getCandidateSearchRadius() const;
+
+    /// Extra search distance for the adaptive scheduler and pair lists (0 when both are off)
+    float getProximitySkin() const;
+
+    /// Whether a rule of a type is installed
+    template<typename RuleT>
+    bool hasRule() const
+    {
+        for (const auto& rule : m_rules)
+        {
+            if (dynamic_cast<const RuleT*>(rule.get()))
+                return true;
+        }
+        return false;
+    }
+
+    /// Whether two grid sites can bond at all: different entities and, with
+    /// the type rule installed, compatible site types
+    static bool isGridPairBondable(const GridSite& a, const GridSite& b, bool filterSiteTypes);
+
+    /// Largest distance a site of an entity moved from reference positions
+    float getSiteDisplacement(const BondableEntity& entity, const std::vector<physx::PxVec3>& reference) const;
+
+    /// Whether the candidate search could find something the last one did not
+    bool needsCandidateSearch() const;
+
+    /// Force a new candidate search and pair list after a change that can add pairs
+    void invalidateCandidatePairs()
+    {
+        m_candidateSearchNeeded = true;
+        m_verletPairsStale = true;
+    }
+
+    /// Whether the Verlet pair list may be missing a pair in capture range
+    bool needsVerletRebuild() const;
+
+    /// Collect the pairs within capture range + skin from the grid
+    void buildVerletPairs();
+
+    /// Grid slot of a site, or SiteSpatialGrid::kInvalidSlot if not tracked
+    uint32_t getGridSlot(const BondableEntity& entity, uint32_t siteId) const;
+
+    /// Sync a site's grid membership with its availability
+    void refreshGridSite(const BondableEntity& entity, uint32_t siteId);
+
+    /// Drop an entity from the transform cache and the grid
+    void untrackEntity(BondableEntity& entity);
+
+    /// Find potential bond candidates
     std::vector<BondCandidate> findBondCandidates();
 
-    /// Evaluate all rules for a site pair
-    float evaluateRules(
+    /// Strict ordering of candidates: better first
+    static bool isBetterCandidate(const BondCandidate& a, const BondCandidate& b);
+
+    /// Create bonds from the best candidates, up to maxBondsPerFrame
+    void commitCandidates(std::vector<BondCandidate>& candidates);
+
+    /// Queue a site pair for scoring; scores the batch once it is full
+    void addCandidatePair(
+        ScoringScratch& scratch,
         const BondableEntity& e1, uint32_t s1,
         const BondableEntity& e2, uint32_t s2) const;
 
-    /// Actually create the bond (internal)
+    /// Run all rules over the queued pairs and append the survivors to scratch.candidates
+    void scoreCandidateBatch(ScoringScratch& scratch) const;
+
+    /// Run fn(task) for each task, on the worker pool if there is one
+    void runTasks(size_t taskCount, const std::function<void(size_t)>& fn);
+
+    /// Number of tasks to split parallel work into
+    size_t getTaskCount() const;
+
+    /// Record the bond and queue its joint (internal)
+    /// @param countAsFormed Count the bond in bondsFormedThisFrame
     uint64_t createBondInternal(
         BondableEntity& e1, uint32_t s1,
         BondableEntity& e2, uint32_t s2,
         const std::string& bondTypeName,
-        const BondConfig& config);
+        const BondConfig& config,
+        bool countAsFormed);
 
     /// Fire bond formed callbacks
     void fireBondFormed(const Bond& bond);
@@ -0,0 +1,83 @@
+#include "EntityTemplate.h"
+#include <algorithm>
+
+namespace bonding
+{
+
+EntityTemplate::EntityTemplate(
+    const BondableEntityDef& definition,
+    const SiteTypeRegistry* siteTypes,
+    const PropertySchema* propertySchema)
+    : m_definition(definition)
+{
+    m_definition.entityId = 0;
+    m_siteTypeRegistryId = siteTypes ? siteTypes->getId() : 0;
+
+    const auto& sites = m_definition.bondingSites;
+
+    m_localPositions.resize(sites.size());
+    m_localDirections.resize(sites.size());
+    m_siteTypeMasks.resize(sites.size());
+    m_siteBondOffsets.assign(sites.size() + 1, 0);
+    for (size_t i = 0; i < sites.size(); ++i)
+    {
+        m_localPositions[i] = sites[i].getLocalPosition();
+        m_localDirections[i] = sites[i].getLocalDirection();
+        if (siteTypes)
+            m_siteTypeMasks[i] = siteTypes->computeMask(sites[i]);
+
+        // Reserve maxValency bond slots per site
+        m_siteBondOffsets[i + 1] = m_siteBondOffsets[i] + sites[i].maxValency;
+        if (sites[i].maxValency > 0)
+            m_bondableSiteCount++;
+    }
+
+    // Site IDs are usually 0..n-1; fall back to a map only for sparse IDs
+    uint32_t maxSiteId = 0;
+    for (const auto& site : sites)
+    {
+        maxSiteId = std::max(maxSiteId, site.siteId);
+    }
+
+    const bool compact = sites.empty() || maxSiteId < sites.size() * 4 + 16;
+    if (compact && !sites.empty())
+    {
+        m_siteIndexTable.assign(maxSiteId + 1, -1);
+    }
+
+    // First definition wins for duplicate IDs, as with findSite()
+    for (size_t i = sites.size(); i-- > 0;)
+    {
+        if (compact)
+            m_siteIndexTable[sites[i].siteId] = static_cast<int32_t>(i);
+        else
+            m_sparseSiteIndex[sites[i].siteId] = static_cast<int32_t>(i);
+    }
+
+    if (propertySchema)
+    {
+        const PropertyMap* entityMap = &m_definition.properties;
+        m_entityProperties.build(*propertySchema, &entityMap, 1);
+
+        std::vector<const PropertyMap*> siteMaps(sites.size());
+        for (size_t i = 0; i < sites.size(); ++i)
+        {
+            siteMaps[i] = &sites[i].properties;
+        }
+        m_siteProperties.build(*propertySchema, siteMaps.data(), siteMaps.size());
+    }
+}
+
+int32_t EntityTemplate::getSiteIndex(uint32_t siteId) const
+{
+    if (siteId < m_siteIndexTable.size())
+        return m_siteIndexTable[siteId];
+
+    if (m_sparseSiteIndex.empty())
+        return -1;
+
+    auto it = m_sparseSiteIndex.find(siteId);
+    return (it != m_sparseSiteIndex.end()) ? it->second : -1;
+}
+
+} // namespace bonding
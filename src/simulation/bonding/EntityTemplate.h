@@ -0,0 +1,129 @@
+#pragma once
+
+#include "BondableEntityDef.h"
+#include "PropertySchema.h"
+#include "SiteTypeRegistry.h"
+#include <PxPhysicsAPI.h>
+#include <unordered_map>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+namespace bonding
+{
+
+/// Immutable entity definition shared by every entity of a type
+/// Holds the definition together with the lookup tables derived from it (site
+/// ID -> index, local site frames, bond slot layout), so entities built from
+/// the same template carry only a pointer plus their own bonding state.
+///
+/// A template never changes after construction and may be read from any
+/// thread. The definition's entityId and actor pose/velocity are not those of
+/// any particular entity.
+class EntityTemplate
+{
+public:
+    /// Build a template from a definition
+    /// @param siteTypes Registry the site types were interned in; without one
+    ///        the site type masks stay uninterned
+    /// @param propertySchema Schema whose declared properties are copied into
+    ///        typed columns; without one the columns are empty
+    explicit EntityTemplate(
+        const BondableEntityDef& definition,
+        const SiteTypeRegistry* siteTypes = nullptr,
+        const PropertySchema* propertySchema = nullptr);
+
+    /// Get the definition
+    const BondableEntityDef& getDefinition() const { return m_definition; }
+
+    /// Get the entity type
+    const std::string& getEntityType() const { return m_definition.entityType; }
+
+    /// Get the default entity properties
+    const PropertyMap& getProperties() const { return m_definition.properties; }
+
+    /// Declared entity properties in typed columns (one row)
+    const PropertyBlock& getPropertyBlock() const { return m_entityProperties; }
+
+    /// Declared site properties in typed columns (one row per site, by dense index)
+    const PropertyBlock& getSitePropertyBlock() const { return m_siteProperties; }
+
+    /// ID of the schema the property columns were built against (0 if none)
+    uint64_t getPropertySchemaId() const { return m_entityProperties.getSchemaId(); }
+
+    /// Get all site definitions
+    const std::vector<BondingSiteDef>& getSites() const { return m_definition.bondingSites; }
+
+    /// Get number of bonding sites
+    size_t getSiteCount() const { return m_definition.bondingSites.size(); }
+
+    /// Get the dense index of a site (its position in getSites()), or -1
+    int32_t getSiteIndex(uint32_t siteId) const;
+
+    /// Get a site's local position/direction by dense index
+    const physx::PxVec3& getSiteLocalPosition(size_t index) const { return m_localPositions[index]; }
+    const physx::PxVec3& getSiteLocalDirection(size_t index) const { return m_localDirections[index]; }
+
+    /// Get a site's type compatibility masks by dense index
+    const SiteTypeMask& getSiteTypeMask(size_t index) const { return m_siteTypeMasks[index]; }
+
+    /// ID of the registry the site type masks refer to (0 if none)
+    uint64_t getSiteTypeRegistryId() const { return m_siteTypeRegistryId; }
+
+    /// First bond slot of a site by dense index; site i owns maxValency slots
+    uint32_t getSiteBondOffset(size_t index) const { return m_siteBondOffsets[index]; }
+
+    /// Total bond slots over all sites
+    uint32_t getBondSlotCount() const { return m_siteBondOffsets.back(); }
+
+    /// Number of sites with a nonzero valency
+    size_t getBondableSiteCount() const { return m_bondableSiteCount; }
+
+private:
+    BondableEntityDef m_definition;
+
+    /// Site ID -> dense index: direct table when IDs are compact, map otherwise
+    std::vector<int32_t> m_siteIndexTable;
+    std::unordered_map<uint32_t, int32_t> m_sparseSiteIndex;
+
+    /// Local site frames by dense index
+    std::vector<physx::PxVec3> m_localPositions;
+    std::vector<physx::PxVec3> m_localDirections;
+
+    /// Site type masks by dense index
+    std::vector<SiteTypeMask> m_siteTypeMasks;
+    uint64_t m_siteTypeRegistryId = 0;
+
+    /// Declared properties of the entity and of each site
+    PropertyBlock m_entityProperties;
+    PropertyBlock m_siteProperties;
+
+    /// Bond slot layout; one entry per site plus the total
+    std::vector<uint32_t> m_siteBondOffsets;
+    size_t m_bondableSiteCount = 0;
+};
+
+/// Shared pointer type for entity templates
+using EntityTemplatePtr = std::shared_ptr<const EntityTemplate>;
+
+/// Per-entity placement of an entity created from a template
+struct EntityPlacement
+{
+    physx::PxTransform pose{physx::PxIdentity};
+    physx::PxVec3 linearVelocity{0.0f};
+    physx::PxVec3 angularVelocity{0.0f};
+
+    /// Placement stored in an actor definition
+    static EntityPlacement fromActorDef(const ActorDef& def)
+    {
+        EntityPlacement placement;
+        placement.pose = physx::PxTransform(
+            physx::PxVec3(def.posX, def.posY, def.posZ),
+            physx::PxQuat(def.quatX, def.quatY, def.quatZ, def.quatW));
+        placement.linearVelocity = physx::PxVec3(def.velX, def.velY, def.velZ);
+        placement.angularVelocity = physx::PxVec3(def.angVelX, def.angVelY, def.angVelZ);
+        return placement;
+    }
+};
+
+} // namespace bonding
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "BondableEntity.h"
+#include "BondCandidateBatch.h"
 #include <string>
 #include <memory>
 
@@ -34,6 +35,19 @@ public:
         const BondableEntity& e1, uint32_t s1,
         const BondableEntity& e2, uint32_t s2) const = 0;
 
+    /// Evaluate every pair of a batch
+    /// The default implementation calls evaluate() per pair; rules with cheap
+    /// geometric tests override it to work on the batch's component arrays.
+    /// @param batch Candidate pairs (only pairs not vetoed by earlier rules)
+    /// @param scores Output, one score per pair with the same meaning as evaluate()
+    virtual void evaluateBatch(const BondCandidateBatch& batch, float* scores) const
+    {
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            scores[i] = evaluate(*batch.entity1[i], batch.site1[i], *batch.entity2[i], batch.site2[i]);
+        }
+    }
+
     /// Get the priority of this rule (higher = evaluated first)
     /// Rules with higher priority can short-circuit evaluation
     virtual int getPriority() const { return 0; }
@@ -69,6 +69,24 @@ public:
         const Bond& bond,
         const BondConfig& config) const = 0;
 
+    /// Rebind a joint this type created earlier to a new bond
+    /// Used by the joint pool. The joint still carries the settings of its
+    /// previous bond, so everything createJoint() sets must be set again.
+    /// The default implementation does not support reuse.
+    /// @param joint Joint to reuse (created by this type's createJoint())
+    /// @return True if the joint was rebound, false if it cannot be reused
+    virtual bool reconfigureJoint(
+        physx::PxJoint* joint,
+        physx::PxRigidActor* actor1, const physx::PxTransform& frame1,
+        physx::PxRigidActor* actor2, const physx::PxTransform& frame2,
+        const Bond& bond,
+        const BondConfig& config) const
+    {
+        (void)joint; (void)actor1; (void)frame1; (void)actor2; (void)frame2;
+        (void)bond; (void)config;
+        return false;
+    }
+
     /// Get a JointDef that represents this bond type
     /// Useful for serialization and scene export
     virtual JointDef getJointDef(const Bond& bond, const BondConfig& config) const = 0;
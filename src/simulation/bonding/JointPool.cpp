@@ -0,0 +1,68 @@
+#include "JointPool.h"
+
+namespace bonding
+{
+
+void JointPool::setCapacity(size_t capacity)
+{
+    m_capacity = capacity;
+
+    while (m_joints.size() > m_capacity)
+    {
+        m_joints.back()->release();
+        m_joints.pop_back();
+    }
+}
+
+physx::PxJoint* JointPool::acquire()
+{
+    if (m_joints.empty())
+        return nullptr;
+
+    physx::PxJoint* joint = m_joints.back();
+    m_joints.pop_back();
+    return joint;
+}
+
+bool JointPool::park(physx::PxJoint* joint)
+{
+    if (!joint || m_joints.size() >= m_capacity)
+        return false;
+
+    // Jointed actors only collide with eCOLLISION_ENABLED, so set it while the
+    // joint is parked; the bond type resets it when the joint is reused
+    joint->setConstraintFlag(physx::PxConstraintFlag::eDISABLE_CONSTRAINT, true);
+    joint->setConstraintFlag(physx::PxConstraintFlag::eCOLLISION_ENABLED, true);
+    m_joints.push_back(joint);
+    return true;
+}
+
+void JointPool::releaseAttachedTo(const physx::PxRigidActor* actor)
+{
+    for (size_t i = 0; i < m_joints.size();)
+    {
+        physx::PxRigidActor* actor1 = nullptr;
+        physx::PxRigidActor* actor2 = nullptr;
+        m_joints[i]->getActors(actor1, actor2);
+
+        if (actor1 == actor || actor2 == actor)
+        {
+            m_joints[i]->release();
+            m_joints[i] = m_joints.back();
+            m_joints.pop_back();
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+void JointPool::clear()
+{
+    for (physx::PxJoint* joint : m_joints)
+        joint->release();
+    m_joints.clear();
+}
+
+} // namespace bonding
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <vector>
+#include <cstddef>
+
+namespace bonding
+{
+
+/// Released joints of one bond type kept for reuse
+/// A parked joint stays in the scene attached to its last actors, with its
+/// constraint disabled and collision between the actors enabled, so the
+/// actors move and collide as if the joint had been released. When a bond of the same type forms, the
+/// manager takes a joint from here and has the bond type rebind it
+/// (IBondType::reconfigureJoint) instead of creating a new one, which keeps
+/// workloads that form and break bonds constantly from churning PhysX's
+/// allocators.
+///
+/// The pool does not release its joints on destruction; the owner calls
+/// clear() while the scene is still alive.
+class JointPool
+{
+public:
+    JointPool() = default;
+
+    /// Maximum number of parked joints (0 = pooling off)
+    /// Shrinking the capacity releases the joints over the new limit.
+    void setCapacity(size_t capacity);
+    size_t getCapacity() const { return m_capacity; }
+
+    /// Take a parked joint, or nullptr if none is available
+    /// The joint is still disabled; the caller re-enables it once it is rebound.
+    physx::PxJoint* acquire();
+
+    /// Disable a joint, let its actors collide, and keep it for reuse
+    /// @return False if the pool is full (the caller releases the joint)
+    bool park(physx::PxJoint* joint);
+
+    /// Release parked joints attached to an actor (before the actor is released)
+    void releaseAttachedTo(const physx::PxRigidActor* actor);
+
+    /// Release all parked joints
+    void clear();
+
+    /// Number of parked joints
+    size_t size() const { return m_joints.size(); }
+    bool empty() const { return m_joints.empty(); }
+
+private:
+    std::vector<physx::PxJoint*> m_joints;
+    size_t m_capacity = 0;
+};
+
+} // namespace bonding
@@ -0,0 +1,61 @@
+#include "PropertySchema.h"
+#include <atomic>
+
+namespace bonding
+{
+
+namespace
+{
+    std::atomic<uint64_t> s_nextSchemaId{1};
+}
+
+PropertySchema::PropertySchema()
+    : m_id(s_nextSchemaId.fetch_add(1))
+{
+}
+
+void PropertyBlock::build(const PropertySchema& schema, const PropertyMap* const* maps, size_t rowCount)
+{
+    m_rowCount = rowCount;
+    m_schemaId = schema.getId();
+
+    buildColumn<bool>(schema, maps);
+    buildColumn<int>(schema, maps);
+    buildColumn<float>(schema, maps);
+    buildColumn<double>(schema, maps);
+    buildColumn<std::string>(schema, maps);
+}
+
+template<typename T>
+void PropertyBlock::buildColumn(const PropertySchema& schema, const PropertyMap* const* maps)
+{
+    constexpr size_t columnIndex = PropertyColumnIndex<T>::value;
+    auto& column = std::get<columnIndex>(m_columns);
+
+    column.width = schema.getSlotCount(columnIndex);
+    column.values.assign(m_rowCount * column.width, typename PropertyColumn<T>::Storage{});
+    column.present.assign(m_rowCount * column.width, 0);
+
+    for (size_t row = 0; row < m_rowCount; ++row)
+    {
+        const auto& data = maps[row]->data();
+        if (data.empty())
+            continue;
+
+        for (size_t slot = 0; slot < column.width; ++slot)
+        {
+            auto it = data.find(schema.getName(columnIndex, static_cast<uint32_t>(slot)));
+            if (it == data.end())
+                continue;
+
+            // Same exact-type match as PropertyMap::get<T>()
+            if (const T* value = std::get_if<T>(&it->second))
+            {
+                column.values[row * column.width + slot] = *value;
+                column.present[row * column.width + slot] = 1;
+            }
+        }
+    }
+}
+
+} // namespace bonding
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "PropertyMap.h"
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <cstdint>
+
+namespace bonding
+{
+
+/// Index of each PropertyValue alternative
+/// Column order follows the variant, so std::variant_alternative_t<N,
+/// PropertyValue> is the value type of column N.
+template<typename T>
+struct PropertyColumnIndex;
+
+template<> struct PropertyColumnIndex<bool>        { static constexpr size_t value = 0; };
+template<> struct PropertyColumnIndex<int>         { static constexpr size_t value = 1; };
+template<> struct PropertyColumnIndex<float>       { static constexpr size_t value = 2; };
+template<> struct PropertyColumnIndex<double>      { static constexpr size_t value = 3; };
+template<> struct PropertyColumnIndex<std::string> { static constexpr size_t value = 4; };
+
+/// Number of property columns (one per PropertyValue alternative)
+constexpr size_t kPropertyColumnCount = std::variant_size_v<PropertyValue>;
+
+/// Typed handle to a declared property
+/// Obtained once from PropertySchema::declare() (typically when a rule is
+/// constructed) and then used for lookups without hashing the name. The
+/// name is kept for entities whose values are not in a PropertyBlock.
+template<typename T>
+struct PropertyKey
+{
+    static constexpr uint32_t kInvalidSlot = 0xFFFFFFFFu;
+
+    uint32_t slot = kInvalidSlot;   ///< Index within the column of type T
+    uint64_t schemaId = 0;          ///< Schema the slot belongs to
+    std::string name;
+
+    bool isValid() const { return slot != kInvalidSlot; }
+};
+
+/// Registry of property names that have a fixed slot in typed columns
+/// Each declared name belongs to one value type and gets the next slot of
+/// that type's column. Slots are never reused, so keys stay valid for the
+/// lifetime of the schema. Slots of different schemas are unrelated;
+/// getId() tells schemas apart (IDs are never reused, unlike addresses).
+///
+/// declare() must not run concurrently with anything else; find() and
+/// PropertyBlock::build() may be called from several threads otherwise.
+class PropertySchema
+{
+public:
+    PropertySchema();
+
+    // Disable copy (a copy would share the ID but not later declarations)
+    PropertySchema(const PropertySchema&) = delete;
+    PropertySchema& operator=(const PropertySchema&) = delete;
+
+    /// Unique ID of this schema (never 0)
+    uint64_t getId() const { return m_id; }
+
+    /// Declare a property, or get the key of an existing declaration
+    /// @return Invalid key if the name is already declared with another type
+    template<typename T>
+    PropertyKey<T> declare(const std::string& name)
+    {
+        constexpr size_t column = PropertyColumnIndex<T>::value;
+
+        auto it = m_entries.find(name);
+        if (it != m_entries.end())
+            return makeKey<T>(it->second.column == column ? it->second.slot : PropertyKey<T>::kInvalidSlot, name);
+
+        const uint32_t slot = static_cast<uint32_t>(m_names[column].size());
+        m_names[column].push_back(name);
+        m_entries.emplace(name, Entry{column, slot});
+        return makeKey<T>(slot, name);
+    }
+
+    /// Key of a declared property; invalid if undeclared or of another type
+    template<typename T>
+    PropertyKey<T> find(const std::string& name) const
+    {
+        auto it = m_entries.find(name);
+        if (it == m_entries.end() || it->second.column != PropertyColumnIndex<T>::value)
+            return makeKey<T>(PropertyKey<T>::kInvalidSlot, name);
+
+        return makeKey<T>(it->second.slot, name);
+    }
+
+    /// Number of slots in a column
+    size_t getSlotCount(size_t column) const { return m_names[column].size(); }
+
+    /// Name of a slot
+    const std::string& getName(size_t column, uint32_t slot) const { return m_names[column][slot]; }
+
+    /// Number of declared properties
+    size_t size() const { return m_entries.size(); }
+
+private:
+    struct Entry
+    {
+        size_t column;
+        uint32_t slot;
+    };
+
+    template<typename T>
+    PropertyKey<T> makeKey(uint32_t slot, const std::string& name) const
+    {
+        PropertyKey<T> key;
+        key.slot = slot;
+        key.schemaId = m_id;
+        key.name = name;
+        return key;
+    }
+
+    uint64_t m_id;
+    std::unordered_map<std::string, Entry> m_entries;
+    std::array<std::vector<std::string>, kPropertyColumnCount> m_names;
+};
+
+/// Values of one declared type for the rows of a PropertyBlock
+/// Bools are stored as bytes rather than in vector<bool>.
+template<typename T>
+struct PropertyColumn
+{
+    using Storage = std::conditional_t<std::is_same_v<T, bool>, uint8_t, T>;
+
+    std::vector<Storage> values;
+    std::vector<uint8_t> present;
+    size_t width = 0;
+};
+
+/// Declared properties of one or more PropertyMaps in flat typed columns
+/// Rows are stored back to back: the value of row r for a key of type T is
+/// element r * width + slot of the T column, where width is the number of
+/// T slots declared when the block was built. Keys of another schema, and
+/// keys declared after the block was built, are not covered (see covers()).
+class PropertyBlock
+{
+public:
+    PropertyBlock() = default;
+
+    /// Build from maps[0..rowCount) against the current schema
+    void build(const PropertySchema& schema, const PropertyMap* const* maps, size_t rowCount);
+
+    /// Whether the key belongs to the block's schema and its slot existed
+    /// when the block was built
+    template<typename T>
+    bool covers(const PropertyKey<T>& key) const
+    {
+        return key.schemaId == m_schemaId && m_schemaId != 0 &&
+               key.slot < std::get<PropertyColumnIndex<T>::value>(m_columns).width;
+    }
+
+    /// ID of the schema the block was built against (0 if never built)
+    uint64_t getSchemaId() const { return m_schemaId; }
+
+    /// Value of a covered key in a row, or nullopt if the row's map lacks it
+    /// (or holds another type)
+    template<typename T>
+    std::optional<T> get(size_t row, const PropertyKey<T>& key) const
+    {
+        const auto& column = std::get<PropertyColumnIndex<T>::value>(m_columns);
+        const size_t index = row * column.width + key.slot;
+        if (!column.present[index])
+            return std::nullopt;
+
+        return static_cast<T>(column.values[index]);
+    }
+
+    /// Number of rows
+    size_t getRowCount() const { return m_rowCount; }
+
+private:
+    template<typename T>
+    void buildColumn(const PropertySchema& schema, const PropertyMap* const* maps);
+
+    std::tuple<
+        PropertyColumn<bool>, PropertyColumn<int>, PropertyColumn<float>,
+        PropertyColumn<double>, PropertyColumn<std::string>> m_columns;
+    size_t m_rowCount = 0;
+    uint64_t m_schemaId = 0;
+};
+
+} // namespace bonding
@@ -0,0 +1,261 @@
+#include "RingDetector.h"
+#include <limits>
+
+namespace bonding
+{
+
+void RingDetector::clear()
+{
+    m_rings.clear();
+    m_ringsByBond.clear();
+    m_order.clear();
+    m_orderBySize.clear();
+    m_nextSequence = 0;
+    m_ringCount = 0;
+}
+
+uint32_t RingDetector::onBondFormed(const Bond& bond, float time)
+{
+    const uint64_t id1 = bond.endpoint1.entityId;
+    const uint64_t id2 = bond.endpoint2.entityId;
+
+    // Only a bond inside one cluster can close a ring
+    if (id1 == id2 || !m_clusters.areConnected(id1, id2))
+        return 0;
+
+    const uint32_t maxLength = std::max(getMaxRingSize(), 3u) - 1;
+    const uint32_t pathLength = shortestPath(id1, id2, 0, maxLength);
+
+    // Already bonded directly: a multiple bond, not a ring
+    if (pathLength == 1)
+        return 0;
+
+    // Beyond the limit the path is unknown; the ring is kept by its closing bond
+    const uint32_t ringSize = (pathLength > 0) ? pathLength + 1 : 0;
+    if (ringSize == 0)
+    {
+        m_path.clear();
+    }
+
+    m_ringCount++;
+    addRing({bond.bondId, id1, id2}, ringSize, time);
+    m_rings[bond.bondId].closedByBond = true;
+
+    return ringSize;
+}
+
+void RingDetector::onBondRemoved(uint64_t bondId, float time)
+{
+    auto it = m_ringsByBond.find(bondId);
+    if (it == m_ringsByBond.end())
+        return;
+
+    // removeRing() edits m_ringsByBond, so work from a copy
+    const std::vector<uint64_t> closingBonds = it->second;
+
+    m_remeasure.clear();
+    for (uint64_t closingBondId : closingBonds)
+    {
+        auto ringIt = m_rings.find(closingBondId);
+        if (ringIt == m_rings.end())
+            continue;
+
+        for (const RingBond& ringBond : ringIt->second.bonds)
+        {
+            if (ringBond.bondId != bondId)
+            {
+                m_remeasure.push_back(ringBond);
+            }
+        }
+        removeRing(closingBondId);
+    }
+
+    std::sort(m_remeasure.begin(), m_remeasure.end(),
+        [](const RingBond& a, const RingBond& b) { return a.bondId < b.bondId; });
+    m_remeasure.erase(std::unique(m_remeasure.begin(), m_remeasure.end(),
+        [](const RingBond& a, const RingBond& b) { return a.bondId == b.bondId; }), m_remeasure.end());
+
+    // A bond of a dropped ring may still close one along another path
+    const uint32_t maxLength = std::max(getMaxRingSize(), 3u) - 1;
+    for (const RingBond& ringBond : m_remeasure)
+    {
+        // Still on a ring, possibly one found earlier in this loop
+        if (m_ringsByBond.count(ringBond.bondId))
+            continue;
+
+        const uint32_t pathLength = shortestPath(ringBond.entity1Id, ringBond.entity2Id, ringBond.bondId, maxLength);
+        if (pathLength >= 2)
+        {
+            addRing(ringBond, pathLength + 1, time);
+        }
+    }
+}
+
+void RingDetector::onBondUndone(uint64_t bondId)
+{
+    auto it = m_rings.find(bondId);
+    if (it != m_rings.end() && it->second.closedByBond)
+    {
+        it->second.closedByBond = false;
+        m_ringCount--;
+    }
+}
+
+const RingEvent* RingDetector::findFirstRing(uint32_t ringSize) const
+{
+    const std::set<std::pair<uint64_t, uint64_t>>* order = &m_order;
+    if (ringSize != 0)
+    {
+        auto it = m_orderBySize.find(ringSize);
+        if (it == m_orderBySize.end())
+            return nullptr;
+        order = &it->second;
+    }
+
+    if (order->empty())
+        return nullptr;
+
+    return &m_rings.at(order->begin()->second).event;
+}
+
+void RingDetector::addRing(const RingBond& closing, uint32_t ringSize, float time)
+{
+    Ring& ring = m_rings[closing.bondId];
+    ring.event.bondId = closing.bondId;
+    ring.event.ringSize = ringSize;
+    ring.event.time = time;
+    ring.sequence = m_nextSequence++;
+    ring.closedByBond = false;
+
+    ring.bonds.clear();
+    ring.bonds.push_back(closing);
+    ring.bonds.insert(ring.bonds.end(), m_path.begin(), m_path.end());
+
+    for (const RingBond& ringBond : ring.bonds)
+    {
+        m_ringsByBond[ringBond.bondId].push_back(closing.bondId);
+    }
+
+    m_order.emplace(ring.sequence, closing.bondId);
+    if (ringSize > 0)
+    {
+        m_orderBySize[ringSize].emplace(ring.sequence, closing.bondId);
+    }
+}
+
+void RingDetector::removeRing(uint64_t closingBondId)
+{
+    auto it = m_rings.find(closingBondId);
+    if (it == m_rings.end())
+        return;
+
+    const Ring& ring = it->second;
+    for (const RingBond& ringBond : ring.bonds)
+    {
+        auto bondIt = m_ringsByBond.find(ringBond.bondId);
+        if (bondIt == m_ringsByBond.end())
+            continue;
+
+        auto& rings = bondIt->second;
+        rings.erase(std::remove(rings.begin(), rings.end(), closingBondId), rings.end());
+        if (rings.empty())
+        {
+            m_ringsByBond.erase(bondIt);
+        }
+    }
+
+    m_order.erase({ring.sequence, closingBondId});
+
+    auto sizeIt = m_orderBySize.find(ring.event.ringSize);
+    if (sizeIt != m_orderBySize.end())
+    {
+        sizeIt->second.erase({ring.sequence, closingBondId});
+        if (sizeIt->second.empty())
+        {
+            m_orderBySize.erase(sizeIt);
+        }
+    }
+
+    m_rings.erase(it);
+}
+
+uint32_t RingDetector::shortestPath(uint64_t from, uint64_t to, uint64_t excludedBondId, uint32_t maxLength)
+{
+    m_path.clear();
+    for (int side = 0; side < 2; ++side)
+    {
+        m_visits[side].clear();
+        m_frontier[side].clear();
+    }
+    m_visits[0][from] = {0, from, 0};
+    m_visits[1][to] = {0, to, 0};
+    m_frontier[0].push_back(from);
+    m_frontier[1].push_back(to);
+
+    uint32_t depth[2] = {0, 0};
+
+    // Expand the smaller frontier one full layer at a time. The first layer that
+    // meets the other side yields the shortest path, taking the best meeting in it.
+    while (depth[0] + depth[1] < maxLength && !m_frontier[0].empty() && !m_frontier[1].empty())
+    {
+        const int side = (m_frontier[0].size() <= m_frontier[1].size()) ? 0 : 1;
+        const int other = 1 - side;
+
+        uint32_t best = std::numeric_limits<uint32_t>::max();
+        RingBond meeting{0, 0, 0};
+        m_nextFrontier.clear();
+
+        for (uint64_t node : m_frontier[side])
+        {
+            const uint32_t nextDistance = m_visits[side][node].distance + 1;
+            for (const BondEdge& edge : m_graph.getEdges(node))
+            {
+                if (edge.neighborId == node || edge.bondId == excludedBondId)
+                    continue;
+
+                auto otherIt = m_visits[other].find(edge.neighborId);
+                if (otherIt != m_visits[other].end() && nextDistance + otherIt->second.distance < best)
+                {
+                    best = nextDistance + otherIt->second.distance;
+                    meeting = {edge.bondId, node, edge.neighborId};
+                }
+
+                if (m_visits[side].emplace(edge.neighborId, Visit{nextDistance, node, edge.bondId}).second)
+                {
+                    m_nextFrontier.push_back(edge.neighborId);
+                }
+            }
+        }
+
+        depth[side]++;
+        m_frontier[side].swap(m_nextFrontier);
+
+        if (best != std::numeric_limits<uint32_t>::max())
+        {
+            if (best > maxLength)
+                return 0;
+
+            tracePath(side, meeting.entity1Id);
+            m_path.push_back(meeting);
+            tracePath(other, meeting.entity2Id);
+            return best;
+        }
+    }
+
+    return 0;
+}
+
+void RingDetector::tracePath(int side, uint64_t node)
+{
+    for (;;)
+    {
+        const Visit& visit = m_visits[side].at(node);
+        if (visit.distance == 0)
+            return;
+
+        m_path.push_back({visit.bondId, visit.parentId, node});
+        node = visit.parentId;
+    }
+}
+
+} // namespace bonding
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "BondGraph.h"
+#include "ClusterTracker.h"
+#include <algorithm>
+#include <unordered_map>
+#include <map>
+#include <set>
+#include <vector>
+#include <cstdint>
+
+namespace bonding
+{
+
+/// A ring in the current bond graph
+struct RingEvent
+{
+    uint64_t bondId = 0;      ///< Bond that closed the ring
+    uint32_t ringSize = 0;    ///< Entities in the smallest ring through the bond; 0 = beyond the search limit
+    float time = 0.0f;        ///< Simulation time the ring was detected
+};
+
+/// Detects rings as bonds form and drops them as bonds break
+/// A bond closes a ring exactly when its two entities are already in the same
+/// cluster. Only then is the ring measured, with a bidirectional BFS over the
+/// bond graph bounded by the maximum ring size, so the work is done once per
+/// bond event no matter how many metrics or conditions read the result.
+///
+/// Each ring keeps the bonds along it. When any of them is removed the ring is
+/// dropped, and its other bonds are measured again, so a ring that still
+/// exists along another path is found again. A ring beyond the search limit
+/// is known by its closing bond only: it is dropped when that bond is removed,
+/// and is not found again by the re-measurement.
+///
+/// A second bond between two entities that are already bonded directly is not
+/// counted as a ring.
+class RingDetector
+{
+public:
+    RingDetector(const BondGraph& graph, const ClusterTracker& clusters)
+        : m_graph(graph), m_clusters(clusters) {}
+
+    // Disable copy (holds references to the graph and clusters)
+    RingDetector(const RingDetector&) = delete;
+    RingDetector& operator=(const RingDetector&) = delete;
+
+    /// Forget all detected rings
+    void clear();
+
+    /// Largest ring measured exactly; larger rings are reported with size 0
+    void setMaxRingSize(uint32_t maxRingSize) { m_maxRingSize = maxRingSize; }
+    uint32_t getMaxRingSize() const { return std::max(m_maxRingSize, m_requiredRingSize); }
+
+    /// Measure rings of at least this size exactly, whatever setMaxRingSize()
+    /// says; rings detected before the call keep their size
+    void requireRingSize(uint32_t ringSize) { m_requiredRingSize = std::max(m_requiredRingSize, ringSize); }
+
+    /// Check a new bond for ring closure
+    /// Must be called before the bond is added to the graph and clusters.
+    /// @return Size of the ring closed (0 if none or beyond the limit)
+    uint32_t onBondFormed(const Bond& bond, float time);
+
+    /// Drop the rings through a removed bond and look for rings left along
+    /// other paths
+    /// Must be called after the bond is removed from the graph.
+    void onBondRemoved(uint64_t bondId, float time);
+
+    /// Forget that a bond closed a ring, for a bond undone before it took
+    /// effect; onBondRemoved() must follow as usual
+    void onBondUndone(uint64_t bondId);
+
+    /// Oldest ring currently in the graph of a given size (0 = any ring), or nullptr
+    const RingEvent* findFirstRing(uint32_t ringSize = 0) const;
+
+    /// Number of bonds that closed a ring
+    size_t getRingCount() const { return m_ringCount; }
+
+    /// Number of rings currently in the graph
+    size_t getLiveRingCount() const { return m_rings.size(); }
+
+private:
+    /// A bond along a ring
+    struct RingBond
+    {
+        uint64_t bondId;
+        uint64_t entity1Id;
+        uint64_t entity2Id;
+    };
+
+    struct Ring
+    {
+        RingEvent event;
+        uint64_t sequence = 0;            ///< Detection order
+        bool closedByBond = false;        ///< Recorded by onBondFormed() and counted in getRingCount()
+        std::vector<RingBond> bonds;      ///< Closing bond included; only it when beyond the limit
+    };
+
+    /// BFS visit of a node: distance from the side's root and how it was reached
+    struct Visit
+    {
+        uint32_t distance;
+        uint64_t parentId;
+        uint64_t bondId;
+    };
+
+    const BondGraph& m_graph;
+    const ClusterTracker& m_clusters;
+    uint32_t m_maxRingSize = 32;
+    uint32_t m_requiredRingSize = 0;
+
+    std::unordered_map<uint64_t, Ring> m_rings;                          ///< By closing bond
+    std::unordered_map<uint64_t, std::vector<uint64_t>> m_ringsByBond;  ///< Bond -> closing bonds of its rings
+    std::set<std::pair<uint64_t, uint64_t>> m_order;                     ///< (sequence, closing bond)
+    std::map<uint32_t, std::set<std::pair<uint64_t, uint64_t>>> m_orderBySize;
+    uint64_t m_nextSequence = 0;
+    size_t m_ringCount = 0;
+
+    // BFS scratch, reused between events
+    std::unordered_map<uint64_t, Visit> m_visits[2];
+    std::vector<uint64_t> m_frontier[2];
+    std::vector<uint64_t> m_nextFrontier;
+    std::vector<RingBond> m_path;
+    std::vector<RingBond> m_remeasure;
+
+    /// Shortest path between two entities avoiding one bond, or 0 if longer
+    /// than maxLength; the path's bonds are left in m_path
+    uint32_t shortestPath(uint64_t from, uint64_t to, uint64_t excludedBondId, uint32_t maxLength);
+
+    /// Append the bonds from a visited node back to its side's root to m_path
+    void tracePath(int side, uint64_t node);
+
+    /// Record a ring closed by a bond; m_path holds the rest of the ring
+    void addRing(const RingBond& closing, uint32_t ringSize, float time);
+
+    /// Forget a ring and unlink it from its bonds
+    void removeRing(uint64_t closingBondId);
+};
+
+} // namespace bonding
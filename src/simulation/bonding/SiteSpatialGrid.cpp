@@ -0,0 +1,474 @@
+#include "SiteSpatialGrid.h"
+#include <algorithm>
+#include <cmath>
+
+namespace bonding
+{
+
+namespace
+{
+    /// Below this size std::sort beats the radix passes
+    constexpr size_t kRadixSortThreshold = 256;
+
+    /// Spread the low 21 bits of v so that there are two zero bits between each
+    uint64_t splitBy3(uint32_t v)
+    {
+        uint64_t x = v & 0x1FFFFF;
+        x = (x | (x << 32)) & 0x001F00000000FFFFull;
+        x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+        x = (x | (x << 8))  & 0x100F00F00F00F00Full;
+        x = (x | (x << 4))  & 0x10C30C30C30C30C3ull;
+        x = (x | (x << 2))  & 0x1249249249249249ull;
+        return x;
+    }
+
+    /// Inverse of splitBy3
+    uint32_t compactBy3(uint64_t x)
+    {
+        x &= 0x1249249249249249ull;
+        x = (x | (x >> 2))  & 0x10C30C30C30C30C3ull;
+        x = (x | (x >> 4))  & 0x100F00F00F00F00Full;
+        x = (x | (x >> 8))  & 0x001F0000FF0000FFull;
+        x = (x | (x >> 16)) & 0x001F00000000FFFFull;
+        x = (x | (x >> 32)) & 0x00000000001FFFFFull;
+        return static_cast<uint32_t>(x);
+    }
+}
+
+// =============================================================================
+// Site Management
+// =============================================================================
+
+void SiteSpatialGrid::clear()
+{
+    m_slotCount = 0;
+    m_posX.clear();
+    m_posY.clear();
+    m_posZ.clear();
+    m_slotKeys.clear();
+    m_slotSorted.clear();
+    m_slotFlags.clear();
+    m_freeSlots.clear();
+    m_dirtySlots.clear();
+
+    m_sortedX.clear();
+    m_sortedY.clear();
+    m_sortedZ.clear();
+    m_sortedSlots.clear();
+    m_sortedKeys.clear();
+
+    m_cells.clear();
+    m_cellTable.clear();
+    m_rebuildAll = false;
+}
+
+void SiteSpatialGrid::reserve(size_t siteCount)
+{
+    m_posX.reserve(siteCount);
+    m_posY.reserve(siteCount);
+    m_posZ.reserve(siteCount);
+    m_slotKeys.reserve(siteCount);
+    m_slotSorted.reserve(siteCount);
+    m_slotFlags.reserve(siteCount);
+}
+
+void SiteSpatialGrid::setCellSize(float cellSize)
+{
+    if (cellSize <= 0.0f || cellSize == m_cellSize)
+        return;
+
+    m_cellSize = cellSize;
+    m_rebuildAll = true;
+}
+
+uint32_t SiteSpatialGrid::addSite(const physx::PxVec3& position, bool active)
+{
+    uint32_t slot;
+    if (!m_freeSlots.empty())
+    {
+        slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        slot = m_slotCount++;
+        m_posX.push_back(0.0f);
+        m_posY.push_back(0.0f);
+        m_posZ.push_back(0.0f);
+        m_slotKeys.push_back(0);
+        m_slotSorted.push_back(kNotSorted);
+        m_slotFlags.push_back(0);
+    }
+
+    m_posX[slot] = position.x;
+    m_posY[slot] = position.y;
+    m_posZ[slot] = position.z;
+    m_slotKeys[slot] = computeKey(slot);
+    m_slotFlags[slot] = static_cast<uint8_t>((m_slotFlags[slot] & SLOT_DIRTY) | SLOT_IN_USE | (active ? SLOT_ACTIVE : 0));
+
+    markDirty(slot);
+    return slot;
+}
+
+void SiteSpatialGrid::removeSite(uint32_t slot)
+{
+    if (slot >= m_slotCount || !(m_slotFlags[slot] & SLOT_IN_USE))
+        return;
+
+    m_slotFlags[slot] &= static_cast<uint8_t>(~(SLOT_IN_USE | SLOT_ACTIVE));
+    m_freeSlots.push_back(slot);
+    markDirty(slot);
+}
+
+bool SiteSpatialGrid::moveSite(uint32_t slot, const physx::PxVec3& position)
+{
+    if (slot >= m_slotCount || !(m_slotFlags[slot] & SLOT_IN_USE))
+        return false;
+
+    m_posX[slot] = position.x;
+    m_posY[slot] = position.y;
+    m_posZ[slot] = position.z;
+
+    uint64_t key = computeKey(slot);
+    if (key == m_slotKeys[slot])
+    {
+        // Same cell: patch the sorted copy in place
+        uint32_t sortedIndex = m_slotSorted[slot];
+        if (sortedIndex != kNotSorted)
+        {
+            m_sortedX[sortedIndex] = position.x;
+            m_sortedY[sortedIndex] = position.y;
+            m_sortedZ[sortedIndex] = position.z;
+        }
+        return false;
+    }
+
+    m_slotKeys[slot] = key;
+    if (m_slotFlags[slot] & SLOT_ACTIVE)
+    {
+        markDirty(slot);
+    }
+    return true;
+}
+
+void SiteSpatialGrid::setSiteActive(uint32_t slot, bool active)
+{
+    if (slot >= m_slotCount || !(m_slotFlags[slot] & SLOT_IN_USE))
+        return;
+
+    if (isSiteActive(slot) == active)
+        return;
+
+    if (active)
+        m_slotFlags[slot] |= SLOT_ACTIVE;
+    else
+        m_slotFlags[slot] &= static_cast<uint8_t>(~SLOT_ACTIVE);
+
+    markDirty(slot);
+}
+
+bool SiteSpatialGrid::isSiteActive(uint32_t slot) const
+{
+    return slot < m_slotCount && (m_slotFlags[slot] & SLOT_ACTIVE) != 0;
+}
+
+uint64_t SiteSpatialGrid::encodeMorton(uint32_t x, uint32_t y, uint32_t z)
+{
+    return splitBy3(x) | (splitBy3(y) << 1) | (splitBy3(z) << 2);
+}
+
+void SiteSpatialGrid::decodeMorton(uint64_t key, uint32_t& x, uint32_t& y, uint32_t& z)
+{
+    x = compactBy3(key);
+    y = compactBy3(key >> 1);
+    z = compactBy3(key >> 2);
+}
+
+uint32_t SiteSpatialGrid::cellCoord(float value) const
+{
+    float scaled = std::floor(value / m_cellSize);
+
+    // Clamp before converting; clamping is monotonic so adjacency is preserved
+    if (!(scaled >= static_cast<float>(-kCoordBias)))
+        return 0;
+    if (scaled >= static_cast<float>(kCoordBias))
+        return static_cast<uint32_t>(kCoordMax);
+
+    return static_cast<uint32_t>(static_cast<int32_t>(scaled) + kCoordBias);
+}
+
+uint64_t SiteSpatialGrid::computeKey(uint32_t slot) const
+{
+    return encodeMorton(cellCoord(m_posX[slot]), cellCoord(m_posY[slot]), cellCoord(m_posZ[slot]));
+}
+
+void SiteSpatialGrid::markDirty(uint32_t slot)
+{
+    if (m_slotFlags[slot] & SLOT_DIRTY)
+        return;
+
+    m_slotFlags[slot] |= SLOT_DIRTY;
+    m_dirtySlots.push_back(slot);
+}
+
+// =============================================================================
+// Cell List Maintenance
+// =============================================================================
+
+void SiteSpatialGrid::update()
+{
+    if (m_rebuildAll)
+    {
+        rebuildAll();
+    }
+    else if (!m_dirtySlots.empty())
+    {
+        applyDirty();
+    }
+    else
+    {
+        return;
+    }
+
+    for (uint32_t slot : m_dirtySlots)
+    {
+        m_slotFlags[slot] &= static_cast<uint8_t>(~SLOT_DIRTY);
+    }
+    m_dirtySlots.clear();
+    m_rebuildAll = false;
+
+    gatherSorted();
+    buildCells();
+}
+
+void SiteSpatialGrid::rebuildAll()
+{
+    m_sortedKeys.clear();
+    m_sortedSlots.clear();
+
+    for (uint32_t slot = 0; slot < m_slotCount; ++slot)
+    {
+        m_slotSorted[slot] = kNotSorted;
+        if (!(m_slotFlags[slot] & SLOT_IN_USE))
+            continue;
+
+        m_slotKeys[slot] = computeKey(slot);
+        if (m_slotFlags[slot] & SLOT_ACTIVE)
+        {
+            m_sortedKeys.push_back(m_slotKeys[slot]);
+            m_sortedSlots.push_back(slot);
+        }
+    }
+
+    sortByKey(m_sortedKeys, m_sortedSlots);
+}
+
+void SiteSpatialGrid::applyDirty()
+{
+    // Drop every dirty entry from the sorted list; survivors stay in order
+    size_t kept = 0;
+    for (size_t i = 0; i < m_sortedSlots.size(); ++i)
+    {
+        uint32_t slot = m_sortedSlots[i];
+        if (m_slotFlags[slot] & SLOT_DIRTY)
+        {
+            m_slotSorted[slot] = kNotSorted;
+            continue;
+        }
+        m_sortedKeys[kept] = m_sortedKeys[i];
+        m_sortedSlots[kept] = slot;
+        kept++;
+    }
+    m_sortedKeys.resize(kept);
+    m_sortedSlots.resize(kept);
+
+    // Re-insert the dirty sites that are still active
+    m_pendingKeys.clear();
+    m_pendingSlots.clear();
+    for (uint32_t slot : m_dirtySlots)
+    {
+        if ((m_slotFlags[slot] & (SLOT_IN_USE | SLOT_ACTIVE)) == (SLOT_IN_USE | SLOT_ACTIVE))
+        {
+            m_pendingKeys.push_back(m_slotKeys[slot]);
+            m_pendingSlots.push_back(slot);
+        }
+    }
+
+    if (m_pendingSlots.empty())
+        return;
+
+    sortByKey(m_pendingKeys, m_pendingSlots);
+
+    // Merge the two sorted runs
+    const size_t total = m_sortedKeys.size() + m_pendingKeys.size();
+    m_scratchKeys.resize(total);
+    m_scratchSlots.resize(total);
+
+    size_t a = 0, b = 0, out = 0;
+    while (a < m_sortedKeys.size() && b < m_pendingKeys.size())
+    {
+        if (m_pendingKeys[b] < m_sortedKeys[a])
+        {
+            m_scratchKeys[out] = m_pendingKeys[b];
+            m_scratchSlots[out++] = m_pendingSlots[b++];
+        }
+        else
+        {
+            m_scratchKeys[out] = m_sortedKeys[a];
+            m_scratchSlots[out++] = m_sortedSlots[a++];
+        }
+    }
+    for (; a < m_sortedKeys.size(); ++a, ++out)
+    {
+        m_scratchKeys[out] = m_sortedKeys[a];
+        m_scratchSlots[out] = m_sortedSlots[a];
+    }
+    for (; b < m_pendingKeys.size(); ++b, ++out)
+    {
+        m_scratchKeys[out] = m_pendingKeys[b];
+        m_scratchSlots[out] = m_pendingSlots[b];
+    }
+
+    m_sortedKeys.swap(m_scratchKeys);
+    m_sortedSlots.swap(m_scratchSlots);
+}
+
+void SiteSpatialGrid::sortByKey(std::vector<uint64_t>& keys, std::vector<uint32_t>& slots)
+{
+    const size_t count = keys.size();
+    if (count < 2)
+        return;
+
+    if (count < kRadixSortThreshold)
+    {
+        // Sorting by (key, slot) is deterministic regardless of input order
+        std::vector<std::pair<uint64_t, uint32_t>> entries(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            entries[i] = {keys[i], slots[i]};
+        }
+        std::sort(entries.begin(), entries.end());
+        for (size_t i = 0; i < count; ++i)
+        {
+            keys[i] = entries[i].first;
+            slots[i] = entries[i].second;
+        }
+        return;
+    }
+
+    // LSD radix sort, 8 bits per pass; passes where every key shares the digit are skipped
+    m_scratchKeys.resize(count);
+    m_scratchSlots.resize(count);
+
+    for (int shift = 0; shift < 64; shift += 8)
+    {
+        size_t offsets[256] = {};
+        for (size_t i = 0; i < count; ++i)
+        {
+            offsets[(keys[i] >> shift) & 0xFF]++;
+        }
+
+        if (offsets[(keys[0] >> shift) & 0xFF] == count)
+            continue;
+
+        size_t running = 0;
+        for (size_t& offset : offsets)
+        {
+            size_t bucketSize = offset;
+            offset = running;
+            running += bucketSize;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t dst = offsets[(keys[i] >> shift) & 0xFF]++;
+            m_scratchKeys[dst] = keys[i];
+            m_scratchSlots[dst] = slots[i];
+        }
+
+        keys.swap(m_scratchKeys);
+        slots.swap(m_scratchSlots);
+    }
+}
+
+void SiteSpatialGrid::gatherSorted()
+{
+    // Copy positions into key order so pair tests stream through memory
+    const size_t count = m_sortedSlots.size();
+    m_sortedX.resize(count);
+    m_sortedY.resize(count);
+    m_sortedZ.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint32_t slot = m_sortedSlots[i];
+        m_sortedX[i] = m_posX[slot];
+        m_sortedY[i] = m_posY[slot];
+        m_sortedZ[i] = m_posZ[slot];
+        m_slotSorted[slot] = static_cast<uint32_t>(i);
+    }
+}
+
+void SiteSpatialGrid::buildCells()
+{
+    m_cells.clear();
+
+    const size_t count = m_sortedKeys.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (m_cells.empty() || m_cells.back().key != m_sortedKeys[i])
+        {
+            Cell cell;
+            cell.key = m_sortedKeys[i];
+            cell.begin = static_cast<uint32_t>(i);
+            decodeMorton(cell.key, cell.x, cell.y, cell.z);
+            m_cells.push_back(cell);
+        }
+        m_cells.back().end = static_cast<uint32_t>(i + 1);
+    }
+
+    // Power-of-two table at most half full
+    size_t tableSize = 16;
+    uint32_t shift = 60;
+    while (tableSize < m_cells.size() * 2)
+    {
+        tableSize <<= 1;
+        shift--;
+    }
+    m_cellTableShift = shift;
+    m_cellTable.assign(tableSize, kNoCell);
+
+    for (uint32_t c = 0; c < m_cells.size(); ++c)
+    {
+        uint32_t slot = hashSlot(m_cells[c].key);
+        while (m_cellTable[slot] != kNoCell)
+        {
+            slot = (slot + 1) & static_cast<uint32_t>(tableSize - 1);
+        }
+        m_cellTable[slot] = c;
+    }
+}
+
+uint32_t SiteSpatialGrid::hashSlot(uint64_t key) const
+{
+    // Fibonacci hashing; the top bits select the slot
+    return static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> m_cellTableShift);
+}
+
+uint32_t SiteSpatialGrid::findCell(uint64_t key) const
+{
+    if (m_cellTable.empty())
+        return kNoCell;
+
+    const uint32_t mask = static_cast<uint32_t>(m_cellTable.size() - 1);
+    uint32_t slot = hashSlot(key);
+    while (m_cellTable[slot] != kNoCell)
+    {
+        uint32_t cell = m_cellTable[slot];
+        if (m_cells[cell].key == key)
+            return cell;
+        slot = (slot + 1) & mask;
+    }
+    return kNoCell;
+}
+
+} // namespace bonding
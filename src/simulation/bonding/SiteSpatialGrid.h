@@ -0,0 +1,253 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+namespace bonding
+{
+
+/// Uniform-grid broadphase over bonding site positions
+/// Sites are stored in flat SoA arrays, sorted into cells by Morton key, and
+/// pairs are enumerated with a 13-cell half-neighbour stencil so each pair of
+/// neighbouring cells is visited exactly once.
+///
+/// Sites live in persistent slots. Moving a site within its cell only updates
+/// its stored position; the sorted cell list is touched by update() only for
+/// sites that changed cell, were added/removed, or were (de)activated, and is
+/// left alone entirely when nothing changed.
+///
+/// Usage:
+///   slot = grid.addSite(pos); ... grid.moveSite(slot, pos); grid.setSiteActive(slot, false);
+///   grid.update();
+///   grid.forEachPair(maxDistance, [](uint32_t slotA, uint32_t slotB) { ... });
+class SiteSpatialGrid
+{
+public:
+    /// Slot value that never refers to a site
+    static constexpr uint32_t kInvalidSlot = 0xFFFFFFFFu;
+
+    SiteSpatialGrid() = default;
+
+    /// Remove all sites and cells
+    void clear();
+
+    /// Reserve storage for a number of sites
+    void reserve(size_t siteCount);
+
+    /// Set the cell edge length; must be >= the pair search distance
+    /// Changing it re-keys every site on the next update()
+    void setCellSize(float cellSize);
+
+    /// Add a site
+    /// @return Slot of the site; slots of removed sites are reused
+    uint32_t addSite(const physx::PxVec3& position, bool active = true);
+
+    /// Remove a site and free its slot
+    void removeSite(uint32_t slot);
+
+    /// Set the position of a site
+    /// @return True if the site moved to a different cell
+    bool moveSite(uint32_t slot, const physx::PxVec3& position);
+
+    /// Include or exclude a site from pair queries (position is kept)
+    void setSiteActive(uint32_t slot, bool active);
+
+    /// Check whether a site takes part in pair queries
+    bool isSiteActive(uint32_t slot) const;
+
+    /// Stored position of a site
+    physx::PxVec3 getSitePosition(uint32_t slot) const
+    {
+        return physx::PxVec3(m_posX[slot], m_posY[slot], m_posZ[slot]);
+    }
+
+    /// Apply pending changes to the cell list
+    void update();
+
+    /// Visit every pair of active sites closer than maxDistance exactly once
+    /// Reflects the state at the last update(). maxDistance must not exceed the cell size.
+    /// @param fn Callable as fn(uint32_t slotA, uint32_t slotB)
+    template<typename PairFn>
+    void forEachPair(float maxDistance, PairFn&& fn) const;
+
+    /// Same as forEachPair(), restricted to pairs whose stencil origin is a cell in
+    /// [firstCell, lastCell). Disjoint ranges visit disjoint pairs, so ranges can be
+    /// processed on different threads.
+    template<typename PairFn>
+    void forEachPairInCells(size_t firstCell, size_t lastCell, float maxDistance, PairFn&& fn) const;
+
+    /// Number of slots in use (active or not)
+    size_t getSiteCount() const { return m_slotCount - m_freeSlots.size(); }
+
+    /// Number of sites in the cell list after update()
+    size_t getActiveSiteCount() const { return m_sortedSlots.size(); }
+
+    /// Number of occupied cells after update()
+    size_t getCellCount() const { return m_cells.size(); }
+
+    /// Current cell size
+    float getCellSize() const { return m_cellSize; }
+
+    /// Interleave three 21-bit cell coordinates into a 63-bit Morton key
+    static uint64_t encodeMorton(uint32_t x, uint32_t y, uint32_t z);
+
+    /// Inverse of encodeMorton()
+    static void decodeMorton(uint64_t key, uint32_t& x, uint32_t& y, uint32_t& z);
+
+private:
+    /// Cell coordinates are biased into [0, 2^21) so they fit the Morton key
+    static constexpr int32_t kCoordBias = 1 << 20;
+    static constexpr int32_t kCoordMax = (1 << 21) - 1;
+    static constexpr uint32_t kNoCell = 0xFFFFFFFFu;
+    static constexpr uint32_t kNotSorted = 0xFFFFFFFFu;
+
+    enum SlotFlags : uint8_t
+    {
+        SLOT_IN_USE = 1 << 0,
+        SLOT_ACTIVE = 1 << 1,
+        SLOT_DIRTY = 1 << 2     ///< Queued in m_dirtySlots
+    };
+
+    struct Cell
+    {
+        uint64_t key = 0;
+        uint32_t begin = 0;   ///< First entry in the sorted arrays
+        uint32_t end = 0;     ///< One past the last entry
+        uint32_t x = 0, y = 0, z = 0;
+    };
+
+    float m_cellSize = 1.0f;
+    bool m_rebuildAll = false;
+
+    // Per-slot state
+    uint32_t m_slotCount = 0;
+    std::vector<float> m_posX, m_posY, m_posZ;
+    std::vector<uint64_t> m_slotKeys;
+    std::vector<uint32_t> m_slotSorted;   ///< Index in the sorted arrays, or kNotSorted
+    std::vector<uint8_t> m_slotFlags;
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<uint32_t> m_dirtySlots;
+
+    // Sorted by cell key: positions, slot, key
+    std::vector<float> m_sortedX, m_sortedY, m_sortedZ;
+    std::vector<uint32_t> m_sortedSlots;
+    std::vector<uint64_t> m_sortedKeys;
+
+    // Sort and merge scratch
+    std::vector<uint64_t> m_pendingKeys, m_scratchKeys;
+    std::vector<uint32_t> m_pendingSlots, m_scratchSlots;
+
+    // Occupied cells in key order, plus an open-addressing key -> cell table
+    std::vector<Cell> m_cells;
+    std::vector<uint32_t> m_cellTable;
+    uint32_t m_cellTableShift = 64;
+
+    /// Cell coordinate of a position along one axis (biased and clamped)
+    uint32_t cellCoord(float value) const;
+
+    /// Cell key of a slot's current position
+    uint64_t computeKey(uint32_t slot) const;
+
+    /// Queue a slot for re-insertion into the cell list
+    void markDirty(uint32_t slot);
+
+    /// Re-key and re-sort every active site
+    void rebuildAll();
+
+    /// Remove dirty entries and merge the re-keyed ones back in
+    void applyDirty();
+
+    /// Stable sort of keys/slots by key
+    void sortByKey(std::vector<uint64_t>& keys, std::vector<uint32_t>& slots);
+
+    /// Refresh sorted positions and slot -> sorted index from m_sortedSlots
+    void gatherSorted();
+
+    /// Build the cell list and lookup table from the sorted keys
+    void buildCells();
+
+    /// Find a cell by key, or kNoCell
+    uint32_t findCell(uint64_t key) const;
+
+    /// Hash slot for a key
+    uint32_t hashSlot(uint64_t key) const;
+};
+
+// =============================================================================
+// Template implementation
+// =============================================================================
+
+template<typename PairFn>
+void SiteSpatialGrid::forEachPair(float maxDistance, PairFn&& fn) const
+{
+    forEachPairInCells(0, m_cells.size(), maxDistance, fn);
+}
+
+template<typename PairFn>
+void SiteSpatialGrid::forEachPairInCells(size_t firstCell, size_t lastCell, float maxDistance, PairFn&& fn) const
+{
+    // Half stencil: offsets lexicographically greater than (0, 0, 0)
+    static const int kStencil[13][3] = {
+        { 0,  0,  1},
+        { 0,  1, -1}, { 0,  1,  0}, { 0,  1,  1},
+        { 1, -1, -1}, { 1, -1,  0}, { 1, -1,  1},
+        { 1,  0, -1}, { 1,  0,  0}, { 1,  0,  1},
+        { 1,  1, -1}, { 1,  1,  0}, { 1,  1,  1}
+    };
+
+    const float maxDist2 = maxDistance * maxDistance;
+
+    auto testPair = [&](uint32_t i, uint32_t j)
+    {
+        float dx = m_sortedX[j] - m_sortedX[i];
+        float dy = m_sortedY[j] - m_sortedY[i];
+        float dz = m_sortedZ[j] - m_sortedZ[i];
+        if (dx * dx + dy * dy + dz * dz <= maxDist2)
+        {
+            fn(m_sortedSlots[i], m_sortedSlots[j]);
+        }
+    };
+
+    lastCell = std::min(lastCell, m_cells.size());
+    for (size_t cellIndex = firstCell; cellIndex < lastCell; ++cellIndex)
+    {
+        const Cell& cell = m_cells[cellIndex];
+
+        // Pairs within the cell
+        for (uint32_t i = cell.begin; i < cell.end; ++i)
+        {
+            for (uint32_t j = i + 1; j < cell.end; ++j)
+            {
+                testPair(i, j);
+            }
+        }
+
+        // Pairs with the forward half of the neighbourhood
+        for (const auto& offset : kStencil)
+        {
+            int32_t nx = static_cast<int32_t>(cell.x) + offset[0];
+            int32_t ny = static_cast<int32_t>(cell.y) + offset[1];
+            int32_t nz = static_cast<int32_t>(cell.z) + offset[2];
+            if (nx < 0 || ny < 0 || nz < 0 || nx > kCoordMax || ny > kCoordMax || nz > kCoordMax)
+                continue;
+
+            uint32_t neighborIndex = findCell(encodeMorton(
+                static_cast<uint32_t>(nx), static_cast<uint32_t>(ny), static_cast<uint32_t>(nz)));
+            if (neighborIndex == kNoCell)
+                continue;
+
+            const Cell& neighbor = m_cells[neighborIndex];
+            for (uint32_t i = cell.begin; i < cell.end; ++i)
+            {
+                for (uint32_t j = neighbor.begin; j < neighbor.end; ++j)
+                {
+                    testPair(i, j);
+                }
+            }
+        }
+    }
+}
+
+} // namespace bonding
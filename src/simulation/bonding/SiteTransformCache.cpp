@@ -0,0 +1,107 @@
+#include "SiteTransformCache.h"
+#include "BondableEntity.h"
+
+namespace bonding
+{
+
+SiteTransformCache::~SiteTransformCache()
+{
+    clear();
+}
+
+void SiteTransformCache::clear()
+{
+    for (Record& record : m_records)
+    {
+        if (record.entity)
+        {
+            record.entity->bindTransformCache(nullptr, 0);
+        }
+    }
+
+    m_records.clear();
+    m_freeRecords.clear();
+    m_positions.clear();
+    m_directions.clear();
+    m_freeRanges.clear();
+    m_active = false;
+}
+
+uint32_t SiteTransformCache::addEntity(BondableEntity& entity)
+{
+    const uint32_t siteCount = static_cast<uint32_t>(entity.getSiteCount());
+
+    // Reuse a freed range of the same length, otherwise append
+    uint32_t firstSite;
+    auto rangeIt = m_freeRanges.find(siteCount);
+    if (rangeIt != m_freeRanges.end() && !rangeIt->second.empty())
+    {
+        firstSite = rangeIt->second.back();
+        rangeIt->second.pop_back();
+    }
+    else
+    {
+        firstSite = static_cast<uint32_t>(m_positions.size());
+        m_positions.resize(m_positions.size() + siteCount);
+        m_directions.resize(m_directions.size() + siteCount);
+    }
+
+    uint32_t recordIndex;
+    if (!m_freeRecords.empty())
+    {
+        recordIndex = m_freeRecords.back();
+        m_freeRecords.pop_back();
+    }
+    else
+    {
+        recordIndex = static_cast<uint32_t>(m_records.size());
+        m_records.emplace_back();
+    }
+
+    Record& record = m_records[recordIndex];
+    record.entity = &entity;
+    record.firstSite = firstSite;
+    record.siteCount = siteCount;
+
+    entity.bindTransformCache(this, recordIndex);
+    refresh(entity);
+
+    return recordIndex;
+}
+
+void SiteTransformCache::removeEntity(BondableEntity& entity)
+{
+    if (entity.getTransformCache() != this)
+        return;
+
+    uint32_t recordIndex = entity.getTransformRecord();
+    Record& record = m_records[recordIndex];
+
+    if (record.siteCount > 0)
+    {
+        m_freeRanges[record.siteCount].push_back(record.firstSite);
+    }
+    record = Record();
+    m_freeRecords.push_back(recordIndex);
+
+    entity.bindTransformCache(nullptr, 0);
+}
+
+void SiteTransformCache::refresh(const BondableEntity& entity)
+{
+    if (entity.getTransformCache() != this)
+        return;
+
+    Record& record = m_records[entity.getTransformRecord()];
+
+    physx::PxRigidActor* actor = entity.getActor();
+    record.pose = actor ? actor->getGlobalPose() : physx::PxTransform(physx::PxIdentity);
+
+    for (uint32_t i = 0; i < record.siteCount; ++i)
+    {
+        m_positions[record.firstSite + i] = record.pose.transform(entity.getSiteLocalPosition(i));
+        m_directions[record.firstSite + i] = record.pose.q.rotate(entity.getSiteLocalDirection(i));
+    }
+}
+
+} // namespace bonding
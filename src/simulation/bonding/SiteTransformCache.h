@@ -0,0 +1,87 @@
+#pragma once
+
+#include <PxPhysicsAPI.h>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace bonding
+{
+
+class BondableEntity;
+
+/// World-space transforms of every bonding site, captured once per bond check
+/// Each entity owns a record holding its pose and a contiguous range in the
+/// position/direction arrays (sites in getAllSites() order). While the cache is
+/// active, BondableEntity world-space queries read from it instead of the actor,
+/// so rules evaluated over many pairs never go back to the PhysX API.
+///
+/// Records persist between checks: only entities passed to refresh() recompute
+/// their site transforms, so sleeping and static actors whose pose still
+/// matches getPose() cost no more than that comparison once captured.
+class SiteTransformCache
+{
+public:
+    SiteTransformCache() = default;
+    ~SiteTransformCache();
+
+    // Disable copy (entities hold a pointer back to the cache)
+    SiteTransformCache(const SiteTransformCache&) = delete;
+    SiteTransformCache& operator=(const SiteTransformCache&) = delete;
+
+    /// Unbind all entities and drop all records
+    void clear();
+
+    /// Allocate a record for an entity, bind the entity to it and capture its pose
+    /// @return Record index
+    uint32_t addEntity(BondableEntity& entity);
+
+    /// Unbind an entity and free its record
+    void removeEntity(BondableEntity& entity);
+
+    /// Re-read an entity's pose and recompute its site transforms
+    void refresh(const BondableEntity& entity);
+
+    /// Route entity world-space queries through the cache
+    void setActive(bool active) { m_active = active; }
+    bool isActive() const { return m_active; }
+
+    /// Cached pose of a record
+    const physx::PxTransform& getPose(uint32_t record) const { return m_records[record].pose; }
+
+    /// Index of a record's first site in the position/direction arrays
+    uint32_t getFirstSiteIndex(uint32_t record) const { return m_records[record].firstSite; }
+
+    /// Cached world position/direction by global site index
+    const physx::PxVec3& getPosition(uint32_t siteIndex) const { return m_positions[siteIndex]; }
+    const physx::PxVec3& getDirection(uint32_t siteIndex) const { return m_directions[siteIndex]; }
+
+    /// Contiguous world positions/directions (indexed by global site index)
+    const physx::PxVec3* getPositions() const { return m_positions.data(); }
+    const physx::PxVec3* getDirections() const { return m_directions.data(); }
+
+    /// Length of the position/direction arrays, freed ranges included
+    size_t getSiteSlotCount() const { return m_positions.size(); }
+
+private:
+    struct Record
+    {
+        BondableEntity* entity = nullptr;
+        uint32_t firstSite = 0;
+        uint32_t siteCount = 0;
+        physx::PxTransform pose = physx::PxTransform(physx::PxIdentity);
+    };
+
+    bool m_active = false;
+
+    std::vector<Record> m_records;
+    std::vector<uint32_t> m_freeRecords;
+
+    std::vector<physx::PxVec3> m_positions;
+    std::vector<physx::PxVec3> m_directions;
+
+    /// Freed site ranges by length; entities of one kind share a site count
+    std::unordered_map<uint32_t, std::vector<uint32_t>> m_freeRanges;
+};
+
+} // namespace bonding
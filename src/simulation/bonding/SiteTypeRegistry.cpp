@@ -0,0 +1,71 @@
+#include "SiteTypeRegistry.h"
+#include <atomic>
+
+namespace bonding
+{
+
+namespace
+{
+    std::atomic<uint64_t> s_nextRegistryId{1};
+}
+
+SiteTypeRegistry::SiteTypeRegistry()
+    : m_id(s_nextRegistryId.fetch_add(1))
+{
+}
+
+void SiteTypeRegistry::intern(const BondingSiteDef& site)
+{
+    intern(site.siteType);
+    for (const auto& type : site.compatibleTypes)
+    {
+        intern(type);
+    }
+}
+
+uint32_t SiteTypeRegistry::intern(const std::string& siteType)
+{
+    auto it = m_types.find(siteType);
+    if (it != m_types.end())
+        return it->second;
+
+    if (m_names.size() >= kMaxTypes)
+        return kInvalidType;
+
+    const uint32_t type = static_cast<uint32_t>(m_names.size());
+    m_names.push_back(siteType);
+    m_types.emplace(siteType, type);
+    return type;
+}
+
+uint32_t SiteTypeRegistry::find(const std::string& siteType) const
+{
+    auto it = m_types.find(siteType);
+    return (it != m_types.end()) ? it->second : kInvalidType;
+}
+
+SiteTypeMask SiteTypeRegistry::computeMask(const BondingSiteDef& site) const
+{
+    SiteTypeMask mask;
+
+    const uint32_t type = find(site.siteType);
+    if (type == kInvalidType)
+        return mask;
+
+    // Empty compatible list means compatible with anything
+    uint64_t acceptMask = site.compatibleTypes.empty() ? ~0ull : 0ull;
+    for (const auto& compatibleType : site.compatibleTypes)
+    {
+        const uint32_t accepted = find(compatibleType);
+        if (accepted == kInvalidType)
+            return mask;
+
+        acceptMask |= 1ull << accepted;
+    }
+
+    mask.typeBit = 1ull << type;
+    mask.acceptMask = acceptMask;
+    return mask;
+}
+
+} // namespace bonding
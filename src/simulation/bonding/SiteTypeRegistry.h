@@ -0,0 +1,81 @@
+#pragma once
+
+#include "BondingSiteDef.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace bonding
+{
+
+/// Site type compatibility of one bonding site as bit masks
+/// Each interned site type owns one bit. A site is compatible with another
+/// when each accepts the other's type, so the check is two ANDs instead of
+/// string comparisons over the compatibleTypes lists.
+struct SiteTypeMask
+{
+    uint64_t typeBit = 0;           ///< Bit of the site's own type; 0 if not interned
+    uint64_t acceptMask = ~0ull;    ///< Types the site bonds with (all if its list is empty)
+
+    /// Whether the masks can be used; otherwise compare type strings
+    bool isInterned() const { return typeBit != 0; }
+};
+
+/// Mutual compatibility of two interned sites
+inline bool areSiteTypesCompatible(const SiteTypeMask& a, const SiteTypeMask& b)
+{
+    return (a.acceptMask & b.typeBit) != 0 && (b.acceptMask & a.typeBit) != 0;
+}
+
+/// Interns site type names into bit indices
+/// Types are only ever added, so masks computed earlier stay valid. Up to
+/// kMaxTypes types can be interned; sites that mention any type beyond that
+/// keep an uninterned mask and are compared by name.
+///
+/// Masks from different registries use unrelated bits; getId() tells
+/// registries apart (IDs are never reused, unlike addresses).
+///
+/// intern() must not run concurrently with anything else; find() and
+/// computeMask() may be called from several threads otherwise.
+class SiteTypeRegistry
+{
+public:
+    static constexpr size_t kMaxTypes = 64;
+    static constexpr uint32_t kInvalidType = 0xFFFFFFFFu;
+
+    SiteTypeRegistry();
+
+    // Disable copy (a copy would share the ID but not later types)
+    SiteTypeRegistry(const SiteTypeRegistry&) = delete;
+    SiteTypeRegistry& operator=(const SiteTypeRegistry&) = delete;
+
+    /// Unique ID of this registry (never 0)
+    uint64_t getId() const { return m_id; }
+
+    /// Intern a site's own type and every type it lists as compatible
+    void intern(const BondingSiteDef& site);
+
+    /// Intern a type name
+    /// @return Type index, or kInvalidType if the registry is full
+    uint32_t intern(const std::string& siteType);
+
+    /// Index of an interned type, or kInvalidType
+    uint32_t find(const std::string& siteType) const;
+
+    /// Name of an interned type
+    const std::string& getName(uint32_t type) const { return m_names[type]; }
+
+    /// Number of interned types
+    size_t size() const { return m_names.size(); }
+
+    /// Masks for a site; uninterned if any type it mentions is not interned
+    SiteTypeMask computeMask(const BondingSiteDef& site) const;
+
+private:
+    uint64_t m_id;
+    std::vector<std::string> m_names;
+    std::unordered_map<std::string, uint32_t> m_types;
+};
+
+} // namespace bonding
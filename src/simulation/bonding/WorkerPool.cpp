@@ -0,0 +1,106 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+namespace bonding
+{
+
+WorkerPool::WorkerPool(uint32_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    m_workers.reserve(threadCount - 1);
+    for (uint32_t i = 1; i < threadCount; ++i)
+    {
+        m_workers.emplace_back(&WorkerPool::workerLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wakeCondition.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void WorkerPool::parallelFor(size_t taskCount, const std::function<void(size_t)>& fn)
+{
+    if (taskCount == 0)
+        return;
+
+    // Nothing to share: run inline without waking anyone
+    if (m_workers.empty() || taskCount == 1)
+    {
+        for (size_t i = 0; i < taskCount; ++i)
+        {
+            fn(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &fn;
+        m_taskCount = taskCount;
+        m_nextTask.store(0);
+        m_busyWorkers = m_workers.size();
+        m_generation++;
+    }
+    m_wakeCondition.notify_all();
+
+    runTasks(fn, taskCount);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this] { return m_busyWorkers == 0; });
+    m_job = nullptr;
+}
+
+void WorkerPool::runTasks(const std::function<void(size_t)>& fn, size_t taskCount)
+{
+    for (size_t task = m_nextTask.fetch_add(1); task < taskCount; task = m_nextTask.fetch_add(1))
+    {
+        fn(task);
+    }
+}
+
+void WorkerPool::workerLoop()
+{
+    uint64_t seenGeneration = 0;
+
+    while (true)
+    {
+        const std::function<void(size_t)>* job;
+        size_t taskCount;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [&] { return m_stopping || m_generation != seenGeneration; });
+            if (m_stopping)
+                return;
+
+            seenGeneration = m_generation;
+            job = m_job;
+            taskCount = m_taskCount;
+        }
+
+        runTasks(*job, taskCount);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_busyWorkers == 0)
+            {
+                m_doneCondition.notify_one();
+            }
+        }
+    }
+}
+
+} // namespace bonding
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstdint>
+
+namespace bonding
+{
+
+/// Small persistent thread pool for splitting per-frame work into tasks
+/// The calling thread takes part in every parallelFor(), so a pool of N threads
+/// starts N - 1 workers. Tasks are claimed dynamically; callers that need a
+/// deterministic result write per-task output and merge it in task order.
+class WorkerPool
+{
+public:
+    /// @param threadCount Total threads including the caller (0 = hardware concurrency)
+    explicit WorkerPool(uint32_t threadCount);
+    ~WorkerPool();
+
+    // Disable copy
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /// Total threads that run tasks, including the caller
+    uint32_t getThreadCount() const { return static_cast<uint32_t>(m_workers.size()) + 1; }
+
+    /// Run fn(taskIndex) for every task in [0, taskCount) and wait for all of them
+    void parallelFor(size_t taskCount, const std::function<void(size_t)>& fn);
+
+private:
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_doneCondition;
+
+    const std::function<void(size_t)>* m_job = nullptr;
+    size_t m_taskCount = 0;
+    std::atomic<size_t> m_nextTask{0};
+    size_t m_busyWorkers = 0;
+    uint64_t m_generation = 0;
+    bool m_stopping = false;
+
+    /// Claim and run tasks of the current job until none are left
+    void runTasks(const std::function<void(size_t)>& fn, size_t taskCount);
+
+    void workerLoop();
+};
+
+} // namespace bonding